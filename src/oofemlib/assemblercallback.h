@@ -35,6 +35,7 @@
 #ifndef assemblercallback_h
 #define assemblercallback_h
 
+#include "oofemcfg.h"
 #include "valuemodetype.h" ///@todo We shouldn't have this for assembling vectors or matrices(!) / Mikael
 #include "matresponsemode.h"
 #include "chartype.h"
@@ -60,7 +61,7 @@ class ActiveBoundaryCondition;
  * Default implementations are that no contributions are considered (empty vectors on output).
  * @author Mikael Öhman
  */
-class VectorAssembler
+class OOFEM_EXPORT VectorAssembler
 {
 public:
     virtual void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const;
@@ -83,7 +84,7 @@ public:
  * Callback class for assembling specific types of matrices
  * @author Mikael Öhman
  */
-class MatrixAssembler
+class OOFEM_EXPORT MatrixAssembler
 {
 public:
     virtual void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const;
@@ -91,6 +92,8 @@ public:
     virtual void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const;
     virtual void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const;
     virtual void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const;
+    /// Product of the element matrix with given vector, default implementation multiplies the matrix from matrixFromElement.
+    virtual void matrixTimesVectorFromElement(FloatArray &vec, Element &element, const FloatArray &v, TimeStep *tStep) const;
 
     virtual void locationFromElement(IntArray &loc, Element &element, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
     virtual void locationFromElementNodes(IntArray &loc, Element &element, const IntArray &bNodes, const UnknownNumberingScheme &s, IntArray *dofIds = nullptr) const;
@@ -101,7 +104,7 @@ public:
  * Implementation for assembling internal forces vectors in standard monolithic, nonlinear FE-problems
  * @author Mikael Öhman
  */
-class InternalForceAssembler : public VectorAssembler
+class OOFEM_EXPORT InternalForceAssembler : public VectorAssembler
 {
 public:
     virtual void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const;
@@ -116,7 +119,7 @@ public:
  * Implementation for assembling external forces vectors in standard monolithic FE-problems
  * @author Mikael Öhman
  */
-class ExternalForceAssembler : public VectorAssembler
+class OOFEM_EXPORT ExternalForceAssembler : public VectorAssembler
 {
 public:
     virtual void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const; ///@todo Temporary: Remove when switch to sets is complete
@@ -131,7 +134,7 @@ public:
  * Implementation for assembling lumped mass matrix (diagonal components) in vector form.
  * @author Mikael Öhman
  */
-class LumpedMassVectorAssembler : public VectorAssembler
+class OOFEM_EXPORT LumpedMassVectorAssembler : public VectorAssembler
 {
 public:
     virtual void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const;
@@ -141,7 +144,7 @@ public:
  * Implementation for assembling the intertia forces vector (i.e. C * dT/dt or M * a)
  * @author Mikael Öhman
  */
-class InertiaForceAssembler : public VectorAssembler
+class OOFEM_EXPORT InertiaForceAssembler : public VectorAssembler
 {
 public:
     virtual void vectorFromElement(FloatArray &vec, Element &element, TimeStep *tStep, ValueModeType mode) const;
@@ -153,7 +156,7 @@ public:
  * This is useful for computing; f = K * u for extrapolated forces, without constructing the K-matrix.
  * @author Mikael Öhman
  */
-class MatrixProductAssembler : public VectorAssembler
+class OOFEM_EXPORT MatrixProductAssembler : public VectorAssembler
 {
 protected:
     MatrixAssembler mAssem;
@@ -173,7 +176,7 @@ public:
  * Implementation for assembling tangent matrices in standard monolithic FE-problems
  * @author Mikael Öhman
  */
-class TangentAssembler : public MatrixAssembler
+class OOFEM_EXPORT TangentAssembler : public MatrixAssembler
 {
 protected:
     ///@todo This is more general than just material responses; we should make a "TangentType"
@@ -188,6 +191,7 @@ public:
     virtual void matrixFromSurfaceLoad(FloatMatrix &mat, Element &element, SurfaceLoad *load, int boundary, TimeStep *tStep) const;
     virtual void matrixFromEdgeLoad(FloatMatrix &mat, Element &element, EdgeLoad *load, int edge, TimeStep *tStep) const;
     virtual void assembleFromActiveBC(SparseMtrx &k, ActiveBoundaryCondition &bc, TimeStep* tStep, const UnknownNumberingScheme &s_r, const UnknownNumberingScheme &s_c) const;
+    virtual void matrixTimesVectorFromElement(FloatArray &vec, Element &element, const FloatArray &v, TimeStep *tStep) const;
 };
 
 
@@ -195,7 +199,7 @@ public:
  * Implementation for assembling the consistent mass matrix
  * @author Mikael Öhman
  */
-class MassMatrixAssembler : public MatrixAssembler
+class OOFEM_EXPORT MassMatrixAssembler : public MatrixAssembler
 {
 public:
     virtual void matrixFromElement(FloatMatrix &mat, Element &element, TimeStep *tStep) const;
@@ -206,7 +210,7 @@ public:
  * Callback class for assembling effective tangents composed of stiffness and mass matrix.
  * @author Mikael Öhman
  */
-class EffectiveTangentAssembler : public MatrixAssembler
+class OOFEM_EXPORT EffectiveTangentAssembler : public MatrixAssembler
 {
 protected:
     double lumped;
@@ -0,0 +1,127 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef blocklanczos_h
+#define blocklanczos_h
+
+#include "sparsegeneigenvalsystemnm.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+
+#include <vector>
+
+///@name Input fields for BlockLanczos
+//@{
+#define _IFT_BlockLanczos_blocksize "blocksize"
+#define _IFT_BlockLanczos_shifts "shifts"
+#define _IFT_BlockLanczos_maxiter "maxiter"
+//@}
+
+namespace oofem {
+class Domain;
+class EngngModel;
+class SparseMtrx;
+
+/**
+ * Shift-invert block Lanczos solver of the generalized eigenvalue problem
+ * @f$ A v = \lambda B v @f$.
+ *
+ * For every shift @f$ \sigma @f$, the matrix @f$ A - \sigma B @f$ is factorized once and the Krylov
+ * subspace of the operator @f$ (A - \sigma B)^{-1} B @f$ is built in blocks of vectors, which are fully
+ * reorthogonalized. The Ritz values are obtained by the Rayleigh-Ritz procedure on the whole basis
+ * (assembled by dense block products), the basis is restarted with the wanted Ritz vectors and their residuals.
+ * The unshifted operator uses the inner product given by A (B may be indefinite, as in the linear stability
+ * analysis), shifted operators use the inner product given by B, which has to be positive definite then.
+ *
+ * The eigenvalues above the first shift are computed. With several shifts (spectrum slicing), every
+ * shift computes the eigenvalues between itself and the next shift, their number is determined from the
+ * inertia of the factorized matrices (requires Skyline). The shifts are processed concurrently with OpenMP.
+ */
+class OOFEM_EXPORT BlockLanczos : public SparseGeneralEigenValueSystemNM
+{
+protected:
+    /// Number of vectors in block.
+    int blockSize;
+    /// Maximum number of restarts.
+    int maxIter;
+    /// Shifts (in ascending order).
+    FloatArray shifts;
+
+public:
+    BlockLanczos(Domain * d, EngngModel * m);
+    virtual ~BlockLanczos() { }
+
+    virtual IRResultType initializeFrom(InputRecord *ir);
+    virtual NM_Status solve(SparseMtrx &A, SparseMtrx &B, FloatArray &x, FloatMatrix &v, double rtol, int nroot);
+    virtual const char *giveClassName() const { return "BlockLanczos"; }
+
+protected:
+    /**
+     * Computes the eigenvalues closest to and above the given shift.
+     * @param A Coefficient matrix.
+     * @param B Coefficient matrix.
+     * @param op Factorized matrix @f$ A - \sigma B @f$.
+     * @param shift Shift @f$ \sigma @f$.
+     * @param nev Number of required eigenvalues.
+     * @param rtol Relative tolerance of residuals.
+     * @param eigv Eigenvalues (in ascending order).
+     * @param r Eigenvectors stored column-wise.
+     * @return True if converged.
+     */
+    bool solveShift(SparseMtrx &A, SparseMtrx &B, SparseMtrx &op, double shift, int nev, double rtol,
+                    FloatArray &eigv, FloatMatrix &r);
+    /**
+     * Orthonormalizes the block with respect to inner product given by matrix G and to the given basis.
+     * Columns, which are linearly dependent on the basis, are replaced by random vectors or removed.
+     * @param G Matrix of inner product.
+     * @param Q Basis blocks.
+     * @param GQ Products of G and basis blocks.
+     * @param W Block to orthonormalize.
+     * @param GW Product of G and orthonormalized block.
+     * @param seed Seed of random vectors.
+     */
+    void orthonormalize(SparseMtrx &G, const std :: vector< FloatMatrix > &Q, const std :: vector< FloatMatrix > &GQ,
+                        FloatMatrix &W, FloatMatrix &GW, unsigned &seed);
+    /**
+     * Returns the inner product @f$ w^T G w @f$, an error is raised if it is negative,
+     * i.e., if the matrix G is not positive definite.
+     */
+    double giveInnerProduct(const FloatArray &w, const FloatArray &gw);
+    /// Computes the product of (column-wise) block of vectors with sparse matrix, all vectors at once.
+    static void times(const SparseMtrx &M, const FloatMatrix &X, FloatMatrix &answer);
+    /// Computes the product of factorized operator @f$ (A - \sigma B)^{-1} B @f$ with block of vectors.
+    static void applyOperator(const SparseMtrx &B, const SparseMtrx &op, const FloatMatrix &X, FloatMatrix &answer);
+};
+} // end namespace oofem
+#endif // blocklanczos_h
@@ -115,6 +115,9 @@ public:
     virtual int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &s);
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    virtual bool computeScatterMap(IntArray &map, const IntArray &loc) const;
+    virtual void assembleScattered(const IntArray &map, const FloatMatrix &mat);
+    virtual bool canBeAssembledConcurrently() const { return true; }
     virtual bool canBeFactorized() const { return false; }
     virtual void zero();
     virtual double &at(int i, int j);
@@ -145,6 +148,8 @@ protected:
     int &col_ptr(int i) { return colptr_(i); }
 
     int size(int i) const { return dim_ [ i ]; }
+    /// Returns the position of coefficient (i,j) (0-based) in val_, by binary search in sorted row indices of column j.
+    int giveValueIndex(int i, int j) const;
     int NumNonzeros() const { return nz_; }
     int base() const { return base_; }
 
@@ -62,12 +62,16 @@ private:
     std::vector< IntArray > nodalConnectivity;
     /// Flag indicating assembled connectivity table for domain.
     int nodalConnectivityFlag;
+    /// Element groups (colours), elements in one group share no dof managers.
+    std::vector< IntArray > elementColoring;
+    /// Flag indicating assembled element colouring for domain.
+    int elementColoringFlag;
 
 public:
     /**
      * Constructor. Creates new Connectivity table belonging to given domain.
      */
-    ConnectivityTable(Domain * d) : domain(d), nodalConnectivity(), nodalConnectivityFlag(0) { }
+    ConnectivityTable(Domain * d) : domain(d), nodalConnectivity(), nodalConnectivityFlag(0), elementColoring(), elementColoringFlag(0) { }
     /// Destructor
     ~ConnectivityTable() { }
     /// reset receiver to an initial state (will force table update, when needed next time)
@@ -98,6 +102,18 @@ public:
      * @param nodeList List of nodes, which neighborhood is searched.
      */
     void giveNodeNeighbourList(IntArray &answer, IntArray &nodeList);
+    /**
+     * Builds the element colouring. Elements are split into groups (colours) by a greedy algorithm,
+     * so that no two elements of the same group share a dof manager, neither directly nor through
+     * master dof managers of their slave dofs.
+     */
+    void instanciateElementColoring();
+    /**
+     * Returns the element colouring. Location arrays of elements in one group are disjoint,
+     * so their contributions can be assembled concurrently without any locking.
+     * @return Groups of element numbers, ordered by colour.
+     */
+    const std::vector< IntArray > &giveElementColoring();
 };
 } // end namespace oofem
 #endif // conTable_h
@@ -36,9 +36,11 @@
 #define datastream_h
 
 #include "oofemcfg.h"
+#include "contextmode.h"
 
 #include <sstream>
 #include <cstdio>
+#include <vector>
 
 namespace oofem {
 /**
@@ -165,5 +167,101 @@ public:
     virtual int givePackSizeOfLong(int count);
 };
 
+
+/**
+ * Implementation of DataStream for binary context (checkpoint) files.
+ * Instead of writing the values one by one to a file, all the data are accumulated in a contiguous memory buffer,
+ * which is written to a file as a single block, optionally compressed by zlib. When restoring,
+ * the block is mapped into memory (if supported and not compressed) or read at once, and the values
+ * are copied directly from it. The cost of saving and restoring thus scales with the size of the data
+ * rather than with the number of (typically small) items written.
+ *
+ * The block is preceded by a header, identifying the format and storing the context mode
+ * the data were written with and an arbitrary user tag.
+ */
+class OOFEM_EXPORT CheckpointDataStream : public DataStream
+{
+protected:
+    /// Buffer with the written data (or with the data read from compressed or not mapped file).
+    std :: vector< char >buffer;
+    /// Data being read, points either into buffer or into mapped file.
+    const char *data;
+    /// Size of the data being read.
+    size_t dataSize;
+    /// Current reading position.
+    size_t pos;
+    /// Mapped file (NULL if file not mapped).
+    void *map;
+    /// Size of mapped file.
+    size_t mapSize;
+    /// Context mode stored in the header.
+    ContextMode mode;
+    /// User tag stored in the header.
+    long tag;
+
+public:
+    /// Constructor, creates empty stream.
+    CheckpointDataStream();
+    /// Destructor, releases the mapped file (if any).
+    virtual ~CheckpointDataStream();
+
+    /// Preallocates the buffer for writing given number of bytes.
+    void reserve(size_t size) { buffer.reserve(size); }
+    /// Returns the number of bytes written into stream.
+    size_t giveSize() const { return buffer.size(); }
+
+    /// Sets the context mode stored in the header.
+    void setContextMode(ContextMode m) { mode = m; }
+    /// Returns the context mode stored in the header.
+    ContextMode giveContextMode() const { return mode; }
+    /// Sets the user tag stored in the header.
+    void setTag(long t) { tag = t; }
+    /// Returns the user tag stored in the header.
+    long giveTag() const { return tag; }
+
+    /**
+     * Writes the header and the accumulated data into given file.
+     * @param file Output file, opened in binary mode.
+     * @param compress If true, the data are compressed (requires zlib support, otherwise ignored).
+     * @return Nonzero if successful.
+     */
+    int writeToFile(FILE *file, bool compress);
+    /**
+     * Reads the header and the data from given file. Uncompressed data are mapped into memory if possible,
+     * the mapping remains valid after the file is closed.
+     * @return Nonzero if successful.
+     */
+    int readFromFile(FILE *file);
+    /// Returns true if given file starts with the checkpoint header. The file is rewound.
+    static bool isCheckpointFile(FILE *file);
+
+    virtual int read(int *data, int count);
+    virtual int read(unsigned long *data, int count);
+    virtual int read(long *data, int count);
+    virtual int read(double *data, int count);
+    virtual int read(char *data, int count);
+    virtual int read(bool &data);
+
+    virtual int write(const int *data, int count);
+    virtual int write(const unsigned long *data, int count);
+    virtual int write(const long *data, int count);
+    virtual int write(const double *data, int count);
+    virtual int write(const char *data, int count);
+    virtual int write(bool data);
+
+    virtual int givePackSizeOfInt(int count);
+    virtual int givePackSizeOfDouble(int count);
+    virtual int givePackSizeOfChar(int count);
+    virtual int givePackSizeOfBool(int count);
+    virtual int givePackSizeOfLong(int count);
+
+protected:
+    /// Copies n bytes from the current position.
+    int readBytes(void *dest, size_t n);
+    /// Appends n bytes to the buffer.
+    int writeBytes(const void *src, size_t n);
+    /// Releases the mapped file.
+    void unmap();
+};
 } // end namespace oofem
 #endif // datastream_h
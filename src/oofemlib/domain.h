@@ -185,6 +185,11 @@ private:
      * because in case of multiple domains stateCounter should be kept independently for each domain.
      */
     StateCounterType nonlocalUpdateStateCounter;
+    /**
+     * Equation numbering state counter. Incremented whenever some dof of the receiver obtains new equation number,
+     * so that cached code numbers (see Element :: giveLocationArray) can be detected as outdated.
+     */
+    StateCounterType equationNumberingStateCounter;
     /// XFEM Manager
     std :: unique_ptr< XfemManager > xfemManager;
 
@@ -560,6 +565,8 @@ public:
     const IntArray &giveDefaultNodeDofIDArry();
     /// Returns domain type.
     domainType giveDomainType() { return dType; }
+    /// Returns domain type name, as given in input record.
+    const std :: string &giveDomainTypeName() const { return mDomainType; }
     /// Sets domain type
     void setDomainType(domainType _dType) { this->dType = _dType; }
     /**
@@ -691,6 +698,15 @@ public:
     StateCounterType giveNonlocalUpdateStateCounter() { return this->nonlocalUpdateStateCounter; }
     /// sets the value of nonlocalUpdateStateCounter
     void setNonlocalUpdateStateCounter(StateCounterType val) { this->nonlocalUpdateStateCounter = val; }
+    /// Returns the value of equationNumberingStateCounter
+    StateCounterType giveEquationNumberingStateCounter() const { return this->equationNumberingStateCounter; }
+    /// Marks the equation numbering of receiver as changed
+    void updateEquationNumberingStateCounter() { this->equationNumberingStateCounter++; }
+    /**
+     * Brings the location arrays cached by elements (see Element :: giveLocationArray) up to date.
+     * Must be called before the elements are processed by several threads, as the caches are not filled in a thread safe way.
+     */
+    void updateLocationArrayCaches();
 
 private:
     void resolveDomainDofsDefaults(const char *);
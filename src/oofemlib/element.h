@@ -198,6 +198,13 @@ protected:
      */
     IntArray partitions;
 
+    /// Cached location array for cacheable (default) numbering scheme, see giveLocationArray.
+    mutable IntArray cachedLocationArray;
+    /// Master dof IDs corresponding to cachedLocationArray.
+    mutable IntArray cachedDofIdArray;
+    /// Equation numbering state of domain, for which the cached location array was computed.
+    mutable StateCounterType cachedLocationArrayState;
+
 public:
     /**
      * Constructor. Creates an element with number n belonging to domain aDomain.
@@ -214,10 +221,18 @@ public:
     //@{
     /**
      * Returns the location array (array of code numbers) of receiver for given numbering scheme.
-     * Results are cached at receiver for default scheme in locationArray attribute.
+     * Results are cached at receiver for cacheable (default) scheme in cachedLocationArray attribute,
+     * until the dofs in domain are renumbered.
      */
     void giveLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
     void giveLocationArray(IntArray &locationArray, const IntArray &dofIDMask, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
+    /**
+     * Updates the location array cached for given numbering scheme, if the scheme is cacheable and the cache is out of date.
+     * The cache is filled in giveLocationArray on demand, which is not thread safe; concurrent loops over elements
+     * therefore fill the caches in advance (see Domain :: updateLocationArrayCaches).
+     * @param s Numbering scheme.
+     */
+    void updateLocationArrayCache(const UnknownNumberingScheme &s) const;
     /**
      * Returns the location array for the boundary of the element.
      * Only takes into account nodes in the bNodes vector.
@@ -274,6 +289,16 @@ public:
      * @param tStep  Time step when answer is computed.
      */
     virtual void giveCharacteristicVector(FloatArray &answer, CharType type, ValueModeType mode, TimeStep *tStep);
+    /**
+     * Computes the product of the tangent stiffness matrix of receiver with given vector.
+     * Used by matrix-free solvers, which never store the global tangent.
+     * The default implementation evaluates the element matrix by giveCharacteristicMatrix,
+     * elements can override it with a cheaper kernel.
+     * @param answer Product of the tangent matrix and v.
+     * @param v Vector of element unknowns (in the coordinate system of the element matrix).
+     * @param tStep Time step when answer is computed.
+     */
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep);
 
     /**
      * @name General methods for obtaining element contributions
@@ -878,6 +903,14 @@ public:
     }
     /// @return Number of integration rules for element.
     int giveNumberOfIntegrationRules() { return (int)this->integrationRulesArray.size(); }
+    /// @return Total number of integration points of all integration rules of element.
+    int giveNumberOfIntegrationPoints() {
+        int n = 0;
+        for ( auto &iRule : integrationRulesArray ) {
+            n += iRule->giveNumberOfIntegrationPoints();
+        }
+        return n;
+    }
     /**
      * @param i Index of integration rule.
      * @return Requested integration rule.
@@ -1203,6 +1236,8 @@ protected:
      * @see IntegrationRule
      */
     virtual void computeGaussPoints() { }
+    /// Evaluates the location array of receiver without caching, see giveLocationArray.
+    void computeLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, IntArray *dofIds = NULL) const;
 };
 
 template< class T > void
@@ -41,6 +41,7 @@
 #include "fieldmanager.h"
 #include "metastep.h"
 #include "timer.h"
+#include "performancemonitor.h"
 #include "assemblercallback.h"
 #include "chartype.h"
 #include "unknowntype.h"
@@ -67,8 +68,12 @@
 //@{
 #define _IFT_EngngModel_nsteps "nsteps"
 #define _IFT_EngngModel_contextoutputstep "contextoutputstep"
+#define _IFT_EngngModel_contextFormat "contextformat"
+#define _IFT_EngngModel_contextCompress "contextcompress"
+#define _IFT_EngngModel_perfReport "perfreport"
 #define _IFT_EngngModel_renumberFlag "renumber"
 #define _IFT_EngngModel_profileOpt "profileopt"
+#define _IFT_EngngModel_scatterMapCache "scattermapcache"
 #define _IFT_EngngModel_nmsteps "nmsteps"
 #define _IFT_EngngModel_nonLinFormulation "nonlinform"
 #define _IFT_EngngModel_eetype "eetype"
@@ -88,6 +93,7 @@ class Domain;
 class TimeStep;
 class Dof;
 class DofManager;
+class Element;
 class DataReader;
 class DataStream;
 class ErrorEstimator;
@@ -220,6 +226,8 @@ protected:
     bool renumberFlag;
     /// Profile optimized numbering flag (using Sloan's algorithm).
     bool profileOpt;
+    /// Flag for caching element scatter maps in sparse matrices (trades memory for faster assembly).
+    bool scatterMapCacheFlag;
     /// Equation numbering completed flag.
     int equationNumberingCompleted;
     /// Number of meta steps.
@@ -246,6 +254,16 @@ protected:
     /// Domain context output mode.
     ContextOutputMode contextOutputMode;
     int contextOutputStep;
+    /// Format of context files (0 - legacy stream of values, 1 - binary checkpoint, see CheckpointDataStream).
+    int contextFormat;
+    /// Flag indicating whether binary context files are compressed.
+    bool contextCompressFlag;
+    /// Number of the last domain definition file written or read (0 if none).
+    int contextDefinitionId;
+    /// Serial numbers of domains at the time the last domain definition file was written.
+    IntArray contextDefinitionSerialNumbers;
+    /// Size of the last written binary context, used to preallocate the next one.
+    size_t lastContextSize;
 
     /// Export module manager.
     ExportModuleManager *exportModuleManager;
@@ -266,6 +284,8 @@ protected:
     EngngModelContext *context;
     /// E-model timer.
     EngngModelTimer timer;
+    /// Hierarchical timers and counters of solution phases.
+    PerformanceMonitor performanceMonitor;
     /// Flag indicating that the receiver runs in parallel.
     int parallelFlag;
     /// Type of non linear formulation (total or updated formulation).
@@ -323,7 +343,11 @@ public:
 
 
 
-    void reduceTimeStep(TimeStep *tStep);
+    /**
+     * Reduces the length of given solution step, which failed to converge and is going to be repeated.
+     * The default implementation halves the step.
+     */
+    virtual void reduceTimeStep(TimeStep *tStep);
     
     /**
      * Service for accessing particular problem domain.
@@ -678,6 +702,28 @@ public:
      * @exception ContextIOERR exception if error encountered.
      */
     virtual contextIOResultType restoreContext(DataStream *stream, ContextMode mode, void *obj = NULL);
+    /**
+     * Stores the state of model into the context file of the current time step, using the context file format
+     * selected in input. For the legacy format, this is equivalent to saveContext(NULL, mode).
+     * With the binary format, the whole context is assembled in memory and written as a single block.
+     * The definition of domains (if requested by mode) is not repeated in every file; it is written
+     * into a separate domain definition file only when the domains have changed since the last one was written,
+     * and the step file only refers to it.
+     * @param mode Determines amount of info stored.
+     * @return contextIOResultType.
+     * @exception ContextIOERR If error encountered.
+     */
+    contextIOResultType saveContextFile(ContextMode mode);
+    /**
+     * Restores the state of model from the context file of given time step.
+     * The format of the file is detected automatically, legacy files are read by restoreContext(NULL, mode, obj).
+     * @param mode Determines amount of info restored.
+     * @param obj Void pointer to an int array containing two values:time step number and
+     * version of a context file to be restored.
+     * @return contextIOResultType.
+     * @exception ContextIOERR If error encountered.
+     */
+    contextIOResultType restoreContextFile(ContextMode mode, void *obj = NULL);
     /**
      * Updates domain links after the domains of receiver have changed. Used mainly after
      * restoring context - the domains may change and this service is then used
@@ -761,6 +807,11 @@ public:
     }
     /// Returns end of time interest (time corresponding to end of time integration).
     virtual double giveEndOfTimeOfInterest() { return 0.; }
+    /**
+     * Returns true if the time stepping has finished before all solution steps have been performed.
+     * Used by models with adaptive time stepping, which end at prescribed time.
+     */
+    virtual bool isTimeSteppingFinished(TimeStep *tStep) { return false; }
     /// Returns the time step number, when initial conditions should apply.
     int giveNumberOfTimeStepWhenIcApply() { return 0; }
     /// Returns reference to receiver's numerical method.
@@ -769,6 +820,8 @@ public:
     ExportModuleManager *giveExportModuleManager() { return exportModuleManager; }
     /// Returns reference to receiver timer (EngngModelTimer).
     EngngModelTimer *giveTimer() { return & timer; }
+    /// Returns receiver's performance monitor.
+    PerformanceMonitor *givePerformanceMonitor() { return & performanceMonitor; }
 
     virtual void resetStiffnessMatrix(){;}
 
@@ -800,6 +853,15 @@ public:
      */
     int giveContextFile(FILE **contextFile, int tStepNumber, int stepVersion,
                         ContextFileMode cmode, int errLevel = 1);
+    /**
+     * Assigns file descriptor of the domain definition file with given number, which is referred to from binary context files.
+     * Returns nonzero on success.
+     * @param contextFile Assigned file descriptor.
+     * @param id Number of the definition file.
+     * @param cmode Determines the i/o mode of context file.
+     * @param errLevel Determines the amount of warning messages if errors are encountered, level 0 no warnings reported.
+     */
+    int giveContextDefinitionFile(FILE **contextFile, int id, ContextFileMode cmode, int errLevel = 1);
     /** Returns true if context file for given step and version is available */
     bool testContextFile(int tStepNumber, int stepVersion);
     /**
@@ -963,6 +1025,32 @@ public:
      */
     void assembleVectorFromElements(FloatArray &answer, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
                                     const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
+    /**
+     * Assembles characteristic vector of required type from a single element (including its body and boundary loads) into given vector.
+     * Called concurrently for elements of the same color when compiled with OpenMP, so it must not modify any shared state except for answer.
+     * @param answer Assembled vector.
+     * @param element Element to assemble from.
+     * @param tStep Time step, when answer is assembled.
+     * @param va Determines what vector is assembled.
+     * @param mode Mode of unknown (total, incremental, rate of change).
+     * @param s Determines the equation numbering scheme.
+     * @param domain Domain to assemble from.
+     * @param eNorms Norms for each dofid (optional).
+     */
+    void assembleVectorFromElement(FloatArray &answer, Element &element, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode,
+                                   const UnknownNumberingScheme &s, Domain *domain, FloatArray *eNorms = NULL);
+    /**
+     * Computes the product of the characteristic matrix of required type with given vector element by element,
+     * without assembling the matrix. Used by matrix-free solvers.
+     * @param answer Product of the matrix with v.
+     * @param v Vector of unknowns (in the numbering given by s).
+     * @param tStep Time step, when answer is computed.
+     * @param ma Determines the matrix.
+     * @param s Determines the equation numbering scheme.
+     * @param domain Domain to assemble from.
+     */
+    void assembleMatrixTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep, const MatrixAssembler &ma,
+                                   const UnknownNumberingScheme &s, Domain *domain);
 
     /**
      * Assembles characteristic vector of required type from boundary conditions.
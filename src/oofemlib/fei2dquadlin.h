@@ -36,6 +36,7 @@
 #define fei2dquadlin_h
 
 #include "feinterpol2d.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -58,6 +59,14 @@ public:
     // Bulk
     virtual void evalN(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual double evaldNdx(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
+    /**
+     * Fixed size variant of evaldNdx, avoids temporary allocations in element kernels.
+     * @param answer Derivatives of shape functions with respect to global coordinates (4 x 2).
+     * @param lcoords Local coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    double evaldNdx(FloatMatrixF< 4, 2 > &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual void local2global(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int  global2local(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual void giveJacobianMatrixAt(FloatMatrix &jacobianMatrix, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
@@ -79,6 +88,8 @@ public:
 
 
     void giveDerivatives(FloatMatrix &dn, const FloatArray &lc);
+    /// Returns the derivatives of shape functions with respect to local coordinates (4 x 2).
+    static FloatMatrixF< 4, 2 >giveDerivativesF(const FloatArray &lc);
 
 protected:
     double edgeComputeLength(IntArray &edgeNodes, const FEICellGeometry &cellgeo);
@@ -36,6 +36,7 @@
 #define fei3dhexalin_h
 
 #include "feinterpol3d.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -55,6 +56,14 @@ public:
     // Bulk
     virtual void evalN(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual double evaldNdx(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
+    /**
+     * Fixed size variant of evaldNdx, avoids temporary allocations in element kernels.
+     * @param answer Derivatives of shape functions with respect to global coordinates (8 x 3).
+     * @param lcoords Local coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    double evaldNdx(FloatMatrixF< 8, 3 > &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual void local2global(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int  global2local(FloatArray &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo);
     virtual int giveNumberOfNodes() const { return 8; }
@@ -89,6 +98,8 @@ public:
 protected:
     double edgeComputeLength(IntArray &edgeNodes, const FEICellGeometry &cellgeo);
     void giveLocalDerivative(FloatMatrix &dN, const FloatArray &lcoords);
+    /// Returns the derivatives of shape functions with respect to local coordinates (8 x 3).
+    static FloatMatrixF< 8, 3 >giveLocalDerivativeF(const FloatArray &lcoords);
 };
 } // end namespace oofem
 #endif //  fei3dhexalin_h
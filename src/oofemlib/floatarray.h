@@ -47,6 +47,7 @@ namespace oofem {
 class IntArray;
 class FloatMatrix;
 class DataStream;
+template< int N > class FloatArrayF;
 
 /**
  * Class representing vector of real numbers. This array can grow or shrink to
@@ -104,6 +105,8 @@ public:
     FloatArray(FloatArray &&src) : values(std::move(src.values)) { }
     /// Initializer list constructor.
     inline FloatArray(std :: initializer_list< double >list) : values(list) { }
+    /// Creates array from fixed size array (defined in floatarrayf.h).
+    template< int N > FloatArray(const FloatArrayF< N > &src);
     /// Destructor.
     virtual ~FloatArray() {};
 
@@ -113,6 +116,8 @@ public:
     FloatArray &operator = (FloatArray &&src) { values = std::move(src.values); return *this; }
     /// Assignment operator.
     inline FloatArray &operator = (std :: initializer_list< double >list) { values = list; return *this; }
+    /// Assignment from fixed size array, reuses allocated space (defined in floatarrayf.h).
+    template< int N > FloatArray &operator = ( const FloatArrayF< N > &src );
 
     /// Add one element
     void push_back(const double &iVal) {values.push_back(iVal);}
@@ -517,16 +522,16 @@ const FloatArray ZeroVector = {0.0,0.0,0.0};
 ///@name IML compatibility
 //@{
 /// Vector multiplication by scalar
-FloatArray &operator *= ( FloatArray & x, const double & a );
-FloatArray operator *( const double & a, const FloatArray & x );
-FloatArray operator *( const FloatArray & x, const double & a );
-FloatArray operator + ( const FloatArray & x, const FloatArray & y );
-FloatArray operator - ( const FloatArray & x, const FloatArray & y );
-FloatArray &operator += ( FloatArray & x, const FloatArray & y );
-FloatArray &operator -= ( FloatArray & x, const FloatArray & y );
+OOFEM_EXPORT FloatArray &operator *= ( FloatArray & x, const double & a );
+OOFEM_EXPORT FloatArray operator *( const double & a, const FloatArray & x );
+OOFEM_EXPORT FloatArray operator *( const FloatArray & x, const double & a );
+OOFEM_EXPORT FloatArray operator + ( const FloatArray & x, const FloatArray & y );
+OOFEM_EXPORT FloatArray operator - ( const FloatArray & x, const FloatArray & y );
+OOFEM_EXPORT FloatArray &operator += ( FloatArray & x, const FloatArray & y );
+OOFEM_EXPORT FloatArray &operator -= ( FloatArray & x, const FloatArray & y );
 
-double norm(const FloatArray &x);
-double dot(const FloatArray &x, const FloatArray &y);
+OOFEM_EXPORT double norm(const FloatArray &x);
+OOFEM_EXPORT double dot(const FloatArray &x, const FloatArray &y);
 //@}
 } // end namespace oofem
 #endif // floatarray_h
@@ -0,0 +1,202 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef floatarrayf_h
+#define floatarrayf_h
+
+#include "oofemcfg.h"
+#include "floatarray.h"
+#include "error.h"
+
+#include <cmath>
+#include <initializer_list>
+#include <algorithm>
+
+namespace oofem {
+/**
+ * Vector of real numbers with size fixed at compile time.
+ *
+ * Intended for small temporary vectors in element and material kernels (Voigt vectors, coordinates, ...),
+ * which are created in large numbers. Unlike FloatArray, the values are stored inside of the object,
+ * so creating, copying and destroying the vector never touches the heap allocator.
+ * The storage is aligned to 16 bytes, allowing the compiler to use packed SIMD instructions.
+ *
+ * The interface follows FloatArray: at() provides 1-based indexing, operator[] and operator() 0-based one.
+ * Arithmetic is provided by free functions (dot, norm, operator+, ...) which return new fixed size objects.
+ * Conversion to FloatArray is implicit, the conversion from FloatArray is explicit and checks the size.
+ *
+ * @see FloatMatrixF
+ */
+template< int N >
+class FloatArrayF
+{
+protected:
+    /// Stored values.
+    alignas(16) double values [ N ];
+
+public:
+    /// Constructor, the array is zeroed.
+    FloatArrayF() { std :: fill(values, values + N, 0.); }
+    /// Initializer list constructor, missing values are zeroed.
+    FloatArrayF(std :: initializer_list< double >list)
+    {
+#ifdef DEBUG
+        if ( ( int ) list.size() > N ) {
+            OOFEM_ERROR("initializer list of size %d does not fit into array of size %d", ( int ) list.size(), N);
+        }
+#endif
+        std :: fill(values, values + N, 0.);
+        std :: copy(list.begin(), list.end(), values);
+    }
+    /// Creates array from dynamic array of the same size.
+    explicit FloatArrayF(const FloatArray &src)
+    {
+#ifdef DEBUG
+        if ( src.giveSize() != N ) {
+            OOFEM_ERROR("size mismatch (%d, expected %d)", src.giveSize(), N);
+        }
+#endif
+        std :: copy(src.givePointer(), src.givePointer() + N, values);
+    }
+
+    /// Returns the size of receiver.
+    int giveSize() const { return N; }
+
+    /// Coefficient access function, provides 1-based indexing.
+    double &at(int i) { return values [ i - 1 ]; }
+    /// Coefficient access function, provides 1-based indexing.
+    double at(int i) const { return values [ i - 1 ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    double &operator[] (int i) { return values [ i ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    const double &operator[] (int i) const { return values [ i ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    double &operator() (int i) { return values [ i ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    const double &operator() (int i) const { return values [ i ]; }
+
+    /// @name Iterator for for-each loops:
+    //@{
+    double *begin() { return values; }
+    double *end() { return values + N; }
+    const double *begin() const { return values; }
+    const double *end() const { return values + N; }
+    //@}
+
+    /// Returns pointer to the stored values.
+    double *givePointer() { return values; }
+    /// Returns pointer to the stored values.
+    const double *givePointer() const { return values; }
+
+    /// Zeroes all coefficients of receiver.
+    void zero() { std :: fill(values, values + N, 0.); }
+
+    FloatArrayF &operator += ( const FloatArrayF &src ) {
+        for ( int i = 0; i < N; ++i ) {
+            values [ i ] += src [ i ];
+        }
+        return * this;
+    }
+    FloatArrayF &operator -= ( const FloatArrayF &src ) {
+        for ( int i = 0; i < N; ++i ) {
+            values [ i ] -= src [ i ];
+        }
+        return * this;
+    }
+    FloatArrayF &operator *= ( double s ) {
+        for ( auto &v : values ) {
+            v *= s;
+        }
+        return * this;
+    }
+};
+
+
+template< int N >
+FloatArrayF< N >operator + ( const FloatArrayF< N > &a, const FloatArrayF< N > &b )
+{
+    FloatArrayF< N >answer(a);
+    return answer += b;
+}
+
+template< int N >
+FloatArrayF< N >operator - ( const FloatArrayF< N > &a, const FloatArrayF< N > &b )
+{
+    FloatArrayF< N >answer(a);
+    return answer -= b;
+}
+
+template< int N >
+FloatArrayF< N >operator *( double s, const FloatArrayF< N > &a )
+{
+    FloatArrayF< N >answer(a);
+    return answer *= s;
+}
+
+template< int N >
+FloatArrayF< N >operator *( const FloatArrayF< N > &a, double s )
+{
+    return s * a;
+}
+
+/// Returns the dot product of two arrays.
+template< int N >
+double dot(const FloatArrayF< N > &a, const FloatArrayF< N > &b)
+{
+    double answer = 0.;
+    for ( int i = 0; i < N; ++i ) {
+        answer += a [ i ] * b [ i ];
+    }
+    return answer;
+}
+
+/// Returns the euclidean norm of the array.
+template< int N >
+double norm(const FloatArrayF< N > &a)
+{
+    return std :: sqrt( dot(a, a) );
+}
+
+
+template< int N >
+FloatArray :: FloatArray(const FloatArrayF< N > &src) : values( src.begin(), src.end() ) { }
+
+template< int N >
+FloatArray &FloatArray :: operator = ( const FloatArrayF< N > &src )
+{
+    values.assign( src.begin(), src.end() );
+    return * this;
+}
+} // end namespace oofem
+#endif // floatarrayf_h
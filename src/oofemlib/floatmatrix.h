@@ -64,6 +64,7 @@ namespace oofem {
 class FloatArray;
 class IntArray;
 class DataStream;
+template< int M, int N > class FloatMatrixF;
 
 /**
  * Implementation of matrix containing floating point numbers. FloatMatrix can grow and shrink
@@ -125,10 +126,14 @@ public:
     FloatMatrix(FloatMatrix && mat) : nRows(mat.nRows), nColumns(mat.nColumns), values( std :: move(mat.values) ) {}
     /// Initializer list constructor.
     FloatMatrix(std :: initializer_list< std :: initializer_list< double > >mat);
+    /// Creates matrix from fixed size matrix (defined in floatmatrixf.h).
+    template< int M, int N > FloatMatrix(const FloatMatrixF< M, N > &src);
     /// Assignment operator.
     FloatMatrix &operator=(std :: initializer_list< std :: initializer_list< double > >mat);
     /// Assignment operator.
     FloatMatrix &operator=(std :: initializer_list< FloatArray >mat);
+    /// Assignment from fixed size matrix, reuses allocated space (defined in floatmatrixf.h).
+    template< int M, int N > FloatMatrix &operator=(const FloatMatrixF< M, N > &src);
     /// Assignment operator, adjusts size of the receiver if necessary.
     FloatMatrix &operator=(const FloatMatrix &mat) {
         nRows = mat.nRows;
@@ -0,0 +1,305 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef floatmatrixf_h
+#define floatmatrixf_h
+
+#include "oofemcfg.h"
+#include "floatarrayf.h"
+#include "floatmatrix.h"
+#include "error.h"
+
+#include <initializer_list>
+#include <algorithm>
+
+namespace oofem {
+/**
+ * Matrix of real numbers with dimensions fixed at compile time.
+ *
+ * Counterpart of FloatArrayF, intended for small temporary matrices in element and material kernels
+ * (material stiffness matrices, strain-displacement matrices, jacobians).
+ * Values are stored column wise inside of the object (same layout as FloatMatrix), aligned to 16 bytes.
+ * Coefficient access follows FloatMatrix: at() is 1-based, operator() 0-based.
+ * Products are provided by free functions (dot, Tdot, rotate, ...), with dimensions checked at compile time.
+ * Conversion to FloatMatrix is implicit, the conversion from FloatMatrix is explicit and checks the size.
+ *
+ * @see FloatArrayF
+ */
+template< int M, int N >
+class FloatMatrixF
+{
+protected:
+    /// Values of matrix stored column wise.
+    alignas(16) double values [ M * N ];
+
+public:
+    /// Constructor, the matrix is zeroed.
+    FloatMatrixF() { std :: fill(values, values + M * N, 0.); }
+    /// Initializer list constructor, the values are given row by row.
+    FloatMatrixF(std :: initializer_list< std :: initializer_list< double > >mat)
+    {
+        std :: fill(values, values + M * N, 0.);
+        int i = 0;
+        for ( auto row : mat ) {
+            int j = 0;
+            for ( double x : row ) {
+                ( * this )( i, j ) = x;
+                j++;
+            }
+            i++;
+        }
+    }
+    /// Creates matrix from dynamic matrix of the same size.
+    explicit FloatMatrixF(const FloatMatrix &src)
+    {
+#ifdef DEBUG
+        if ( src.giveNumberOfRows() != M || src.giveNumberOfColumns() != N ) {
+            OOFEM_ERROR("size mismatch (%d x %d, expected %d x %d)", src.giveNumberOfRows(), src.giveNumberOfColumns(), M, N);
+        }
+#endif
+        std :: copy(src.givePointer(), src.givePointer() + M * N, values);
+    }
+
+    /// Returns number of rows of receiver.
+    int giveNumberOfRows() const { return M; }
+    /// Returns number of columns of receiver.
+    int giveNumberOfColumns() const { return N; }
+
+    /// Coefficient access function, provides 1-based indexing.
+    double &at(int i, int j) { return values [ ( j - 1 ) * M + i - 1 ]; }
+    /// Coefficient access function, provides 1-based indexing.
+    double at(int i, int j) const { return values [ ( j - 1 ) * M + i - 1 ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    double &operator() (int i, int j) { return values [ j * M + i ]; }
+    /// Coefficient access function, provides 0-based indexing.
+    double operator() (int i, int j) const { return values [ j * M + i ]; }
+
+    /// Returns pointer to the stored values.
+    double *givePointer() { return values; }
+    /// Returns pointer to the stored values.
+    const double *givePointer() const { return values; }
+
+    /// Zeroes all coefficients of receiver.
+    void zero() { std :: fill(values, values + M * N, 0.); }
+
+    FloatMatrixF &operator += ( const FloatMatrixF &src ) {
+        for ( int i = 0; i < M * N; ++i ) {
+            values [ i ] += src.values [ i ];
+        }
+        return * this;
+    }
+    FloatMatrixF &operator -= ( const FloatMatrixF &src ) {
+        for ( int i = 0; i < M * N; ++i ) {
+            values [ i ] -= src.values [ i ];
+        }
+        return * this;
+    }
+    FloatMatrixF &operator *= ( double s ) {
+        for ( auto &v : values ) {
+            v *= s;
+        }
+        return * this;
+    }
+};
+
+
+template< int M, int N >
+FloatMatrixF< M, N >operator + ( const FloatMatrixF< M, N > &a, const FloatMatrixF< M, N > &b )
+{
+    FloatMatrixF< M, N >answer(a);
+    return answer += b;
+}
+
+template< int M, int N >
+FloatMatrixF< M, N >operator - ( const FloatMatrixF< M, N > &a, const FloatMatrixF< M, N > &b )
+{
+    FloatMatrixF< M, N >answer(a);
+    return answer -= b;
+}
+
+template< int M, int N >
+FloatMatrixF< M, N >operator *( double s, const FloatMatrixF< M, N > &a )
+{
+    FloatMatrixF< M, N >answer(a);
+    return answer *= s;
+}
+
+/// Returns the transposition of a.
+template< int M, int N >
+FloatMatrixF< N, M >transpose(const FloatMatrixF< M, N > &a)
+{
+    FloatMatrixF< N, M >answer;
+    for ( int i = 0; i < M; ++i ) {
+        for ( int j = 0; j < N; ++j ) {
+            answer(j, i) = a(i, j);
+        }
+    }
+    return answer;
+}
+
+/// Returns the product a.x
+template< int M, int N >
+FloatArrayF< M >dot(const FloatMatrixF< M, N > &a, const FloatArrayF< N > &x)
+{
+    FloatArrayF< M >answer;
+    for ( int j = 0; j < N; ++j ) {
+        double xj = x [ j ];
+        for ( int i = 0; i < M; ++i ) {
+            answer [ i ] += a(i, j) * xj;
+        }
+    }
+    return answer;
+}
+
+/// Returns the product a^T.x
+template< int M, int N >
+FloatArrayF< N >Tdot(const FloatMatrixF< M, N > &a, const FloatArrayF< M > &x)
+{
+    FloatArrayF< N >answer;
+    for ( int j = 0; j < N; ++j ) {
+        double sum = 0.;
+        for ( int i = 0; i < M; ++i ) {
+            sum += a(i, j) * x [ i ];
+        }
+        answer [ j ] = sum;
+    }
+    return answer;
+}
+
+/// Returns the product a.b
+template< int M, int K, int N >
+FloatMatrixF< M, N >dot(const FloatMatrixF< M, K > &a, const FloatMatrixF< K, N > &b)
+{
+    FloatMatrixF< M, N >answer;
+    for ( int j = 0; j < N; ++j ) {
+        for ( int k = 0; k < K; ++k ) {
+            double bkj = b(k, j);
+            for ( int i = 0; i < M; ++i ) {
+                answer(i, j) += a(i, k) * bkj;
+            }
+        }
+    }
+    return answer;
+}
+
+/// Returns the product a^T.b
+template< int K, int M, int N >
+FloatMatrixF< M, N >Tdot(const FloatMatrixF< K, M > &a, const FloatMatrixF< K, N > &b)
+{
+    FloatMatrixF< M, N >answer;
+    for ( int j = 0; j < N; ++j ) {
+        for ( int i = 0; i < M; ++i ) {
+            double sum = 0.;
+            for ( int k = 0; k < K; ++k ) {
+                sum += a(k, i) * b(k, j);
+            }
+            answer(i, j) = sum;
+        }
+    }
+    return answer;
+}
+
+/// Returns the product b^T.d.b, typically used to compute the stiffness matrix contribution of an integration point.
+template< int M, int N >
+FloatMatrixF< N, N >rotate(const FloatMatrixF< M, M > &d, const FloatMatrixF< M, N > &b)
+{
+    return Tdot( b, dot(d, b) );
+}
+
+/// Returns the determinant of 2x2 matrix.
+inline double det(const FloatMatrixF< 2, 2 > &a)
+{
+    return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+}
+
+/// Returns the determinant of 3x3 matrix.
+inline double det(const FloatMatrixF< 3, 3 > &a)
+{
+    return a(0, 0) * ( a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1) ) -
+           a(0, 1) * ( a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0) ) +
+           a(0, 2) * ( a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0) );
+}
+
+/// Returns the inverse of 2x2 matrix.
+inline FloatMatrixF< 2, 2 >inv(const FloatMatrixF< 2, 2 > &a)
+{
+    double d = det(a);
+#ifdef DEBUG
+    if ( d == 0. ) {
+        OOFEM_ERROR("singular matrix");
+    }
+#endif
+    return {
+               { a(1, 1) / d, -a(0, 1) / d },
+               { -a(1, 0) / d, a(0, 0) / d }
+    };
+}
+
+/// Returns the inverse of 3x3 matrix.
+inline FloatMatrixF< 3, 3 >inv(const FloatMatrixF< 3, 3 > &a)
+{
+    double d = det(a);
+#ifdef DEBUG
+    if ( d == 0. ) {
+        OOFEM_ERROR("singular matrix");
+    }
+#endif
+    FloatMatrixF< 3, 3 >answer;
+    answer(0, 0) = ( a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1) ) / d;
+    answer(1, 0) = ( a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2) ) / d;
+    answer(2, 0) = ( a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0) ) / d;
+    answer(0, 1) = ( a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2) ) / d;
+    answer(1, 1) = ( a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0) ) / d;
+    answer(2, 1) = ( a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1) ) / d;
+    answer(0, 2) = ( a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1) ) / d;
+    answer(1, 2) = ( a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2) ) / d;
+    answer(2, 2) = ( a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0) ) / d;
+    return answer;
+}
+
+
+template< int M, int N >
+FloatMatrix :: FloatMatrix(const FloatMatrixF< M, N > &src) :
+    nRows(M), nColumns(N), values( src.givePointer(), src.givePointer() + M * N ) { }
+
+template< int M, int N >
+FloatMatrix &FloatMatrix :: operator=(const FloatMatrixF< M, N > &src)
+{
+    nRows = M;
+    nColumns = N;
+    values.assign( src.givePointer(), src.givePointer() + M * N );
+    return * this;
+}
+} // end namespace oofem
+#endif // floatmatrixf_h
@@ -0,0 +1,171 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef amgprecond_h
+#define amgprecond_h
+
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "intarray.h"
+#include "sparsemtrx.h"
+#include "precond.h"
+
+#include <vector>
+
+///@name Input fields for AMGPreconditioner
+//@{
+#define _IFT_AMGPreconditioner_theta "amgtheta"
+#define _IFT_AMGPreconditioner_maxlevels "amgmaxlevels"
+#define _IFT_AMGPreconditioner_coarsesize "amgcoarsesize"
+#define _IFT_AMGPreconditioner_degree "amgdegree"
+//@}
+
+namespace oofem {
+class Domain;
+
+/**
+ * Smoothed aggregation algebraic multigrid preconditioner for symmetric positive definite matrices
+ * (CompCol and SymCompCol storage).
+ *
+ * The near null space of the operator is given by the rigid body modes computed from the coordinates
+ * of nodes (translations and rotations for displacement and rotation DOFs, constant vectors for other
+ * DOF types). The DOFs of individual nodes are aggregated together, based on the strength of connection
+ * between the nodal blocks of the matrix. The tentative prolongator interpolates the near null space on
+ * aggregates, it is smoothed by one damped Jacobi step. Coarse operators are the Galerkin products,
+ * the coarsest one is solved directly. The V-cycle uses Chebyshev polynomial smoother, so that the
+ * preconditioner remains symmetric.
+ *
+ * The hierarchy (aggregates and prolongators) is built by initStructure, initValues recomputes only the
+ * coarse operators and smoothers, so the hierarchy is reused for matrices with unchanged sparsity pattern.
+ * The setup and the V-cycle are threaded with OpenMP.
+ */
+class OOFEM_EXPORT AMGPreconditioner : public Preconditioner
+{
+protected:
+    /// Sparse matrix in compressed row storage (0-based indices).
+    struct CSRMatrix {
+        int nRows, nColumns;
+        IntArray rowPtr, colInd;
+        FloatArray values;
+
+        CSRMatrix() : nRows(0), nColumns(0) { }
+        /// Computes y = receiver * x.
+        void times(const FloatArray &x, FloatArray &y) const;
+    };
+
+    /// Level of multigrid hierarchy.
+    struct Level {
+        /// Operator of level.
+        CSRMatrix A;
+        /// Prolongator to the level from the next coarser level, and its transposition.
+        CSRMatrix P, R;
+        /// Inverted diagonal of the operator.
+        FloatArray diagInv;
+        /// Estimate of the spectral radius of diagInv * A.
+        double rho;
+    };
+
+    /// Domain providing the node coordinates for rigid body modes.
+    Domain *domain;
+    /// Levels of the hierarchy, the first one is the original matrix.
+    std :: vector< Level > levels;
+    /// Inverse of the operator of coarsest level.
+    FloatMatrix coarseInverse;
+    /// Threshold of strength of connection.
+    double theta;
+    /// Maximum number of levels.
+    int maxLevels;
+    /// Size of the coarsest level.
+    int coarseSize;
+    /// Degree of Chebyshev smoother.
+    int degree;
+    /// Flag indicating that the values of hierarchy correspond to the matrix given to initStructure.
+    bool valuesInitialized;
+
+public:
+    /**
+     * Constructor. The user should call initializeFrom and init services in this given order to ensure consistency.
+     * @param d Domain, which provides the coordinates of nodes (the scalar near null space is used if NULL).
+     */
+    AMGPreconditioner(Domain * d = NULL);
+    /// Destructor.
+    virtual ~AMGPreconditioner() { }
+
+    virtual void init(const SparseMtrx &a);
+    virtual void initStructure(const SparseMtrx &a);
+    virtual void initValues(const SparseMtrx &a);
+
+    virtual void solve(const FloatArray &rhs, FloatArray &solution) const;
+    virtual void trans_solve(const FloatArray &rhs, FloatArray &solution) const { this->solve(rhs, solution); }
+
+    virtual const char *giveClassName() const { return "AMG"; }
+    virtual IRResultType initializeFrom(InputRecord *ir);
+
+protected:
+    /// Converts the CompCol or SymCompCol matrix to the (full) compressed row storage.
+    static void convert(const SparseMtrx &a, CSRMatrix &answer);
+    /**
+     * Computes the near null space of the matrix from the domain.
+     * @param neq Number of equations.
+     * @param B Near null space vectors stored column-wise.
+     * @param blockOf Node (block) index of equations.
+     */
+    void giveNearNullSpace(int neq, FloatMatrix &B, IntArray &blockOf) const;
+    /**
+     * Aggregates the blocks of equations according to the strength of connection.
+     * @param A Operator.
+     * @param blockOf Block index of equations.
+     * @param nblocks Number of blocks.
+     * @param eps Threshold of strength of connection.
+     * @param aggregateOf Aggregate index of blocks.
+     * @return Number of aggregates.
+     */
+    int aggregate(const CSRMatrix &A, const IntArray &blockOf, int nblocks, double eps, IntArray &aggregateOf) const;
+    /// Computes the operators, the smoother coefficients and the coarse inverse for all levels from the first one.
+    void computeOperators();
+    /// Computes the inverse of the operator of coarsest level.
+    void computeCoarseInverse();
+    /// Computes the inverted diagonal and spectral radius estimate of level.
+    static void computeSmoother(Level &level);
+    /// Applies the Chebyshev smoother to the solution of level.
+    void smooth(const Level &level, const FloatArray &b, FloatArray &x) const;
+    /// Performs the V-cycle starting at given level.
+    void vCycle(int l, const FloatArray &b, FloatArray &x) const;
+    /// Computes the sparse matrix product c = a * b.
+    static void multiply(const CSRMatrix &a, const CSRMatrix &b, CSRMatrix &c);
+    /// Computes the transposition of sparse matrix.
+    static void transpose(const CSRMatrix &a, CSRMatrix &answer);
+};
+} // end namespace oofem
+#endif // amgprecond_h
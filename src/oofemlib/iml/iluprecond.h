@@ -66,8 +66,14 @@ public:
     virtual ~CompCol_ILUPreconditioner(void) { }
 
     virtual void init(const SparseMtrx &);
+    virtual void initStructure(const SparseMtrx &);
+    virtual void initValues(const SparseMtrx &);
 
     void initialize(const CompCol &A);
+    /// Splits the pattern of A into pattern of L and U factors.
+    void initializeStructure(const CompCol &A);
+    /// Copies the values of A into L and U factors and computes the incomplete factorization.
+    void initializeValues(const CompCol &A);
     void initialize(const DynCompCol &A);
 
     void solve(const FloatArray &x, FloatArray &y) const;
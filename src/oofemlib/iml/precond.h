@@ -75,6 +75,19 @@ public:
      * @param a Sparse matrix to be preconditioned.
      */
     virtual void init(const SparseMtrx &a) { }
+    /**
+     * Performs the symbolic part of initialization, which depends only on sparsity pattern of given matrix.
+     * Together with initValues allows to reuse the structure of preconditioner for matrices with unchanged pattern.
+     * Default implementation is empty.
+     * @param a Sparse matrix to be preconditioned.
+     */
+    virtual void initStructure(const SparseMtrx &a) { }
+    /**
+     * Performs the numeric part of initialization. The initStructure service has to be called before
+     * for the sparsity pattern of given matrix. Default implementation calls init.
+     * @param a Sparse matrix to be preconditioned.
+     */
+    virtual void initValues(const SparseMtrx &a) { this->init(a); }
 
     /**
      * Solves the linear system.
@@ -49,15 +49,24 @@ namespace oofem {
 class Domain;
 class EngngModel;
 class FloatMatrix;
+class SupernodalSolver;
 
 /**
  * Implements the solution of linear system of equation in the form Ax=b using direct factorization method.
  * Can work with any sparse matrix implementation. However, the sparse matrix implementation have to support
- * its factorization (canBeFactorized method).
+ * its factorization (canBeFactorized method). Symmetric compressed column matrices (SymCompCol) are solved
+ * by built-in supernodal solver.
+ * @see SupernodalSolver
  */
 class OOFEM_EXPORT LDLTFactorization : public SparseLinearSystemNM
 {
 private:
+    /// Solver used for matrices without own factorization support.
+    SupernodalSolver *supernodal;
+    /// Last factorized matrix.
+    SparseMtrx *lhs;
+    /// Version of last factorized matrix.
+    SparseMtrx :: SparseMtrxVersionType lhsVersion;
 
 public:
     /// Constructor - creates new instance of LDLTFactorization, with number i, belonging to domain d and Engngmodel m.
@@ -69,6 +78,8 @@ public:
      * Solves the given linear system by LDL^T factorization.
      * Implementation rely on factorization support provided by mapped sparse matrix.
      * It calls Lhs->factorized()->backSubstitutionWith(*solutionArray). Sets solved flag to 1 if o.k.
+     * Matrices with own factorization support are factorized in place, without separate symbolic phase.
+     * The symbolic factorization is reused only by the supernodal solver of SymCompCol matrices.
      * @param A coefficient matrix
      * @param b right hand side
      * @param x solution array
@@ -76,6 +87,10 @@ public:
      */
     virtual NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
 
+    virtual bool isPatternUnchanged(const SparseMtrx &A) const;
+    virtual void resetSymbolicFactorization();
+    virtual const FactorizationStatistics &giveFactorizationStatistics() const;
+
     virtual const char *giveClassName() const { return "LDLTFactorization"; }
     virtual LinSystSolverType giveLinSystSolverType() const { return ST_Direct; }
     virtual SparseMtrxType giveRecommendedMatrix(bool symmetric) const { return symmetric ? SMT_Skyline : SMT_SkylineU; }
@@ -46,16 +46,20 @@
 #include "matresponsemode.h"
 #include "dictionary.h"
 
+#include <memory>
+
 ///@name Input fields for Material
 //@{
 #define _IFT_Material_density "d"
 #define _IFT_Material_castingtime "castingtime"
+#define _IFT_Material_stateStore "statestore"
 //@}
 
 namespace oofem {
 #define STRAIN_STEPS 10.0
 
 class GaussPoint;
+class MaterialStateStore;
 class Dictionary;
 class FloatArray;
 class FloatMatrix;
@@ -112,6 +116,11 @@ protected:
      */
     double castingTime;
 
+    /// Flag indicating whether history variables of integration points should be kept in contiguous store.
+    bool stateStoreFlag;
+    /// Contiguous store of history variables, created on demand; shared with the records using it.
+    mutable std :: shared_ptr< MaterialStateStore >stateStore;
+
 public:
     /**
      * Constructor. Creates material with given number, belonging to given domain.
@@ -232,6 +241,16 @@ public:
      * @return Zero on error.
      */
     virtual int initMaterial(Element *element);
+
+    /**
+     * Optional function evaluating the receiver in all its integration points in given domain at once, before the element
+     * contributions depending on the internal state are assembled. Multiscale materials use it to solve the subscale problems
+     * of all integration points as one batch, scheduled over the available threads, and keep the results in the statuses
+     * until the elements ask for them. Default implementation does nothing.
+     * @param d Domain.
+     * @param tStep Time step.
+     */
+    virtual void solveSubscaleProblems(Domain *d, TimeStep *tStep) { }
     /**
      * Returns material status of receiver in given integration point.
      * If status does not exist yet, it is created using CreateStatus member function.
@@ -298,6 +317,16 @@ public:
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const
     { return NULL; }
 
+    /**
+     * Returns the store for history records of integration points, which material statuses
+     * supporting it can use instead of individually allocated history variables (see MaterialStateRecord).
+     * The store is created on first request, when enabled in the input record of the material.
+     * @param recordSize Number of history variables in record of single integration point,
+     * all requests should use the same size.
+     * @return Store or empty pointer if not enabled.
+     */
+    std :: shared_ptr< MaterialStateStore >giveStateStore(int recordSize) const;
+
     /**
      * Initializes temporary variables stored in integration point status
      * at the beginning of new time step.
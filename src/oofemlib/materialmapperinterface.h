@@ -37,9 +37,12 @@
 
 #include "interface.h"
 
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
+class GaussPoint;
 class TimeStep;
 
 /**
@@ -70,6 +73,23 @@ public:
      * @return Nonzero if o.k.
      */
     virtual int MMI_map(GaussPoint *gp, Domain *oldd, TimeStep *tStep) = 0;
+    /**
+     * Maps the required internal state variables from old mesh oldd to all given ips.
+     * Models that map many points at once should override this to issue a single pass
+     * of their mapping algorithm; default implementation maps point by point.
+     * @param gps Integration points belonging to new domain which values will be mapped.
+     * @param oldd Old mesh reference.
+     * @param tStep Time step.
+     * @return Nonzero if all points o.k.
+     */
+    virtual int MMI_mapPoints(const std :: vector< GaussPoint * > &gps, Domain *oldd, TimeStep *tStep)
+    {
+        int result = 1;
+        for ( GaussPoint *gp : gps ) {
+            result &= this->MMI_map(gp, oldd, tStep);
+        }
+        return result;
+    }
     /**
      * Updates the required internal state variables from previously mapped values.
      * The result is stored in gp status. This map and update splitting is necessary,
@@ -42,6 +42,8 @@
 #include "internalstatetype.h"
 #include "set.h"
 
+#include <vector>
+
 namespace oofem {
 class Domain;
 class Element;
@@ -138,6 +140,22 @@ public:
      * @return Nonzero if o.k.
      */
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep) = 0;
+    /**
+     * Maps the variables of given types from old mesh to a set of integration points in one pass.
+     * The points are processed in spatial order, so that consecutive points have nearby sources.
+     * The default implementation initializes the receiver for each point in turn and maps all variables,
+     * mappers which can locate the sources and map the points concurrently override it.
+     * @param answer Contains result, variable varTypes.at(k) of i-th point is stored in answer[i * n + k - 1],
+     * where n is the size of varTypes. Variables which could not be mapped are empty.
+     * @param dold Old domain.
+     * @param varTypes Array of InternalStateType values, identifying all vars to be mapped.
+     * @param gps Integration points belonging to new domain to which mapping occur.
+     * @param sourceElemSet Elements of old domain used as sources.
+     * @param tStep Time step.
+     * @return Nonzero if all variables were mapped.
+     */
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, IntArray &varTypes,
+                             const std :: vector< GaussPoint * > &gps, Set &sourceElemSet, TimeStep *tStep);
     /**
      * Initializes receiver according to object description stored in input record.
      * InitString can be imagined as data record in component database
@@ -160,6 +178,15 @@ public:
     virtual const char *giveClassName() const = 0;
     /// Error printing helper.
     std :: string errorInfo(const char *func) const { return std :: string(giveClassName()) + func; }
+
+protected:
+    /**
+     * Sorts integration points along a space filling (Morton) curve.
+     * @param order Indices of points in spatial order.
+     * @param coords Global coordinates of points in spatial order.
+     * @param gps Integration points.
+     */
+    static void giveSpatialOrder(std :: vector< int > &order, std :: vector< FloatArray > &coords, const std :: vector< GaussPoint * > &gps);
 };
 } // end namespace oofem
 #endif // materialmappingalgorithm_h
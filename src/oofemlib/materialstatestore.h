@@ -0,0 +1,229 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef materialstatestore_h
+#define materialstatestore_h
+
+#include "oofemcfg.h"
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace oofem {
+class FloatArray;
+class MaterialStateStore;
+
+/**
+ * Handle to the history record of a single integration point.
+ *
+ * The record is a fixed number of scalar history variables, whose layout (meaning of the particular
+ * entries) is declared by the material status owning the record. Each variable is kept twice,
+ * in two buffers: one holds the converged (equilibrated) value, the other one the temporary value.
+ * The equilibrated state is committed by swapping the roles of the two buffers, no values are copied.
+ * The temporary buffer is then lazily synchronized with the converged one on its first modification,
+ * so that, as usual, the temporary values equal the converged ones after the update.
+ *
+ * The buffers either live in a MaterialStateStore shared by all integration points of the material
+ * (in structure of arrays layout) or, when no store is given, in storage provided by the derived
+ * InlineMaterialStateRecord. The record keeps a reference to the store, so the store is released
+ * only after its last record, regardless of the order in which materials and elements are deleted.
+ */
+class OOFEM_EXPORT MaterialStateRecord
+{
+protected:
+    /// Buffers holding the values, i-th variable is stored at buffers[k][i*stride].
+    double *buffers [ 2 ];
+    /// Distance between two consecutive variables of the record in buffers.
+    int stride;
+    /// Number of variables in the record.
+    int size;
+    /// Index of the buffer holding the converged values.
+    int conv;
+    /// Flag indicating that the temporary buffer is outdated and should be taken from the converged one.
+    bool syncPending;
+    /// Store providing the buffers, empty if the buffers are privately owned.
+    std :: shared_ptr< MaterialStateStore >store;
+    /// Slot of the record in the store.
+    int slot;
+
+    /**
+     * Constructor. Creates record of given size, all values are set to zero.
+     * @param size Number of variables in the record.
+     * @param store Store providing the storage, if empty the private storage is used.
+     * @param local Private storage for 2*size values.
+     */
+    MaterialStateRecord(int size, std :: shared_ptr< MaterialStateStore >store, double *local);
+
+public:
+    /// Destructor. Returns the storage to the store.
+    ~MaterialStateRecord();
+
+    MaterialStateRecord(const MaterialStateRecord &) = delete;
+    MaterialStateRecord &operator = ( const MaterialStateRecord & ) = delete;
+
+    /// Returns number of variables in the record.
+    int giveSize() const { return size; }
+    /// Returns true if the record is kept in a shared store.
+    bool isStored() const { return store != nullptr; }
+
+    /// Returns the converged value of i-th variable (0-based).
+    double give(int i) const { return buffers [ conv ] [ i * stride ]; }
+    /// Returns the temporary value of i-th variable (0-based).
+    double giveTemp(int i) const { return buffers [ syncPending ? conv : 1 - conv ] [ i * stride ]; }
+    /**
+     * Sets the converged value of i-th variable. Intended for initialization and restoring of the state,
+     * the temporary values are reset to converged ones.
+     */
+    void set(int i, double value) {
+        buffers [ conv ] [ i * stride ] = value;
+        syncPending = true;
+    }
+    /// Sets the temporary value of i-th variable.
+    void setTemp(int i, double value) {
+        if ( syncPending ) {
+            this->synchronize();
+        }
+        buffers [ 1 - conv ] [ i * stride ] = value;
+    }
+
+    /// Returns converged values of n variables starting at i-th one.
+    void giveVector(FloatArray &answer, int i, int n) const;
+    /// Returns temporary values of n variables starting at i-th one.
+    void giveTempVector(FloatArray &answer, int i, int n) const;
+    /// Sets converged values of variables starting at i-th one.
+    void setVector(int i, const FloatArray &values);
+    /// Sets temporary values of variables starting at i-th one.
+    void setTempVector(int i, const FloatArray &values);
+
+    /// Resets all temporary values to converged ones.
+    void initTemp() { syncPending = true; }
+    /**
+     * Commits the temporary values as the new converged ones.
+     * The roles of buffers are swapped, temporary values are equal to converged ones afterwards.
+     */
+    void update() {
+        if ( syncPending == false ) {
+            conv = 1 - conv;
+            syncPending = true;
+        }
+    }
+
+protected:
+    /// Copies converged values into the temporary buffer.
+    void synchronize();
+};
+
+
+/**
+ * History record of fixed size, which keeps its values in the receiver when no store is used,
+ * so that statuses without the store do not allocate any additional memory.
+ */
+template< int N >
+class InlineMaterialStateRecord : public MaterialStateRecord
+{
+protected:
+    /// Private storage of the converged and temporary values.
+    double local [ 2 * N ];
+
+public:
+    /**
+     * Constructor. Creates record with all values set to zero.
+     * @param store Store providing the storage, if empty the storage of the receiver is used.
+     */
+    InlineMaterialStateRecord(std :: shared_ptr< MaterialStateStore >store = nullptr) :
+        MaterialStateRecord(N, std :: move(store), local) { }
+};
+
+
+/**
+ * Contiguous storage of history records of integration points belonging to one material.
+ *
+ * Records are allocated in blocks of fixed number of records. Within a block, the storage is organized
+ * as structure of arrays: the values of particular variable of all records in the block are contiguous
+ * and the arrays are aligned to cache line boundary. Every block is allocated twice, providing the
+ * temporary/converged double buffer used by MaterialStateRecord. Blocks are never moved, so the records may
+ * keep the pointers to their values. Freed slots are reused by subsequently allocated records.
+ *
+ * The allocation and release of records is thread safe, the access to a particular record is not synchronized
+ * (integration points are not shared between threads).
+ */
+class OOFEM_EXPORT MaterialStateStore
+{
+protected:
+    /// Number of variables of each record.
+    int recordSize;
+    /// Number of records in one block.
+    int blockSize;
+    /// Aligned blocks, each block consists of two buffers (recordSize*blockSize values each).
+    std::vector< double * >blocks;
+    /// Original (not aligned) allocations of blocks.
+    std::vector< double * >rawBlocks;
+    /// Slots available for reuse.
+    std::vector< int >freeSlots;
+    /// Number of allocated slots (including freed ones).
+    int nSlots;
+
+public:
+    /**
+     * Constructor.
+     * @param recordSize Number of variables in each record.
+     * @param blockSize Number of records allocated at once.
+     */
+    MaterialStateStore(int recordSize, int blockSize = 1024);
+    /// Destructor.
+    ~MaterialStateStore();
+
+    MaterialStateStore(const MaterialStateStore &) = delete;
+    MaterialStateStore &operator = ( const MaterialStateStore & ) = delete;
+
+    /// Returns number of variables in each record.
+    int giveRecordSize() const { return recordSize; }
+    /// Returns number of records currently in use.
+    int giveNumberOfRecords() const { return nSlots - ( int ) freeSlots.size(); }
+    /// Returns size of allocated storage in bytes.
+    size_t giveMemoryUsage() const;
+
+    /**
+     * Allocates storage for new record. The values are initialized to zero.
+     * @param buffers Pointers to the first variable of the record in both buffers.
+     * @param stride Distance between variables of the record.
+     * @return Slot number, to be used to release the record.
+     */
+    int allocate(double *buffers [ 2 ], int &stride);
+    /// Releases the storage of the record in given slot.
+    void release(int slot);
+};
+} // end namespace oofem
+#endif // materialstatestore_h
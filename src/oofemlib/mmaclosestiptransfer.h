@@ -62,6 +62,9 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, IntArray &varTypes,
+                             const std :: vector< GaussPoint * > &gps, Set &sourceElemSet, TimeStep *tStep);
+
     virtual int mapStatus(MaterialStatus &oStatus) const;
 
     virtual const char *giveClassName() const { return "MMAClosestIPTransfer"; }
@@ -62,9 +62,16 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, IntArray &varTypes,
+                             const std :: vector< GaussPoint * > &gps, Set &sourceElemSet, TimeStep *tStep);
+
     virtual int mapStatus(MaterialStatus &oStatus) const;
 
     virtual const char *giveClassName() const { return "MMAContainingElementProjection"; }
+
+protected:
+    /// Returns the integration point of given element closest to given point.
+    static GaussPoint *giveClosestIP(Element *elem, const FloatArray &coords);
 };
 } // end namespace oofem
 #endif // mmacontainingelementprojection_h
@@ -39,6 +39,7 @@
 #include "interface.h"
 
 #include <list>
+#include <vector>
 
 ///@name Input fields for MMALeastSquareProjection
 //@{
@@ -99,6 +100,9 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, IntArray &varTypes,
+                             const std :: vector< GaussPoint * > &gps, Set &sourceElemSet, TimeStep *tStep);
+
     virtual int mapStatus(MaterialStatus &oStatus) const;
 
     virtual IRResultType initializeFrom(InputRecord *ir);
@@ -107,6 +111,23 @@ public:
     virtual const char *giveClassName() const { return "MMALeastSquareProjectionPatchType"; }
 
 protected:
+    /**
+     * Constructs the patch of integration points around given source element.
+     * @param answer Integration points of patch, empty if there are not enough points in the neighbourhood.
+     * @param sourceElement Element of old mesh containing the receiver point.
+     * @param coords Coordinates of the receiver point.
+     * @param elemSet Elements of old mesh which can be used.
+     * @param tStep Time step.
+     * @return Type of patch.
+     */
+    MMALeastSquareProjectionPatchType givePatch(std :: list< GaussPoint * > &answer, Element *sourceElement, const FloatArray &coords,
+                                                Set &elemSet, TimeStep *tStep);
+    /// Evaluates the coordinates and values of given variable in patch points.
+    void givePatchValues(std :: vector< FloatArray > &coords, std :: vector< FloatArray > &values,
+                         const std :: list< GaussPoint * > &patch, InternalStateType type, TimeStep *tStep);
+    /// Evaluates the least square fit of patch values in receiver point.
+    void computePatchFit(FloatArray &answer, const std :: vector< FloatArray > &ipCoords, const std :: vector< FloatArray > &ipValues,
+                         const FloatArray &targetCoords, MMALeastSquareProjectionPatchType type);
     void computePolynomialTerms(FloatArray &P, const FloatArray &coords, MMALeastSquareProjectionPatchType type);
     int giveNumberOfUnknownPolynomialCoefficients(MMALeastSquareProjectionPatchType regType);
 };
@@ -96,6 +96,9 @@ public:
 
     virtual int __mapVariable(FloatArray &answer, const FloatArray &coords, InternalStateType type, TimeStep *tStep);
 
+    virtual int mapVariables(std :: vector< FloatArray > &answer, Domain *dold, IntArray &varTypes,
+                             const std :: vector< GaussPoint * > &gps, Set &sourceElemSet, TimeStep *tStep);
+
     virtual int mapStatus(MaterialStatus &oStatus) const;
 
     void interpolateIntVarAt(FloatArray &answer, Element *elem, const FloatArray &lcoords, std :: vector< FloatArray > &list, InternalStateType type, TimeStep *tStep) const;
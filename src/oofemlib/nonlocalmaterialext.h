@@ -38,8 +38,10 @@
 #include "matstatus.h"
 #include "interface.h"
 #include "intarray.h"
+#include "floatarray.h"
 
-#include <list>
+#include <vector>
+#include <memory>
 
 ///@name Input fields for NonlocalMaterialExtensionInterface
 //@{
@@ -91,7 +93,7 @@ class OOFEM_EXPORT NonlocalMaterialStatusExtensionInterface : public Interface
 {
 protected:
     /// List containing localIntegrationRecord values.
-    std :: list< localIntegrationRecord >integrationDomainList;
+    std :: vector< localIntegrationRecord >integrationDomainList;
     /// Nonlocal volume of corresponding integration point.
     double integrationScale;
 
@@ -109,7 +111,7 @@ public:
      * references to integration points and their weights that influence the nonlocal average in
      * receiver's associated integration point.
      */
-    std :: list< localIntegrationRecord > *giveIntegrationDomainList() { return & integrationDomainList; }
+    std :: vector< localIntegrationRecord > *giveIntegrationDomainList() { return & integrationDomainList; }
     /// Returns associated integration scale.
     double giveIntegrationScale() { return integrationScale; }
     /// Sets associated integration scale.
@@ -119,6 +121,67 @@ public:
 };
 
 
+/**
+ * Uniform grid of cells with integration points which can influence nonlocal averages.
+ * The points of default integration rules of elements in nonlocal regions are stored
+ * in contiguous arrays ordered by element number, the cells refer to them in compressed row storage.
+ * The cells are not smaller than the support radius, so that all points within the support
+ * of a receiver are found in the neighbouring cells. The grid is built once for all integration points,
+ * the per point queries of spatial localizer are then avoided when nonlocal tables are built.
+ */
+class OOFEM_EXPORT NonlocalPointGrid
+{
+protected:
+    /// Integration points stored in grid, ordered by element number.
+    std :: vector< GaussPoint * >points;
+    /// Global coordinates of points.
+    std :: vector< FloatArray >coords;
+    /// Volumes associated to points.
+    std :: vector< double >volumes;
+    /// Offsets of points of individual elements (elements are numbered from 0 in grid).
+    std :: vector< int >elementOffsets;
+    /// Grid element index of each point.
+    std :: vector< int >pointElements;
+    /// Origin of grid.
+    double origin [ 3 ];
+    /// Size of cells.
+    double cellSize;
+    /// Number of cells in each direction.
+    int nCells [ 3 ];
+    /// Offsets of cell items.
+    std :: vector< int >cellOffsets;
+    /// Points of cells, sorted within cell.
+    std :: vector< int >cellItems;
+
+public:
+    /**
+     * Creates grid with all points of elements of given domain, which belong to regions with zero region map value.
+     * @param d Domain with elements.
+     * @param regionMap Map indicating regions to skip.
+     * @param radius Support radius, the minimum cell size.
+     */
+    NonlocalPointGrid(Domain *d, const IntArray &regionMap, double radius);
+
+    /**
+     * Finds the elements having at least one point within given distance from given point.
+     * @param answer Grid element indices, found elements are added, the list is kept sorted.
+     * @param coords Coordinates of point.
+     * @param radius Distance, should not exceed the support radius the grid was built for.
+     */
+    void giveElementsWithPointsWithinRadius(std :: vector< int > &answer, const FloatArray &coords, double radius) const;
+    /// Returns the index of first point of given element.
+    int giveFirstPoint(int elem) const { return elementOffsets [ elem ]; }
+    /// Returns the index of last point of given element plus one.
+    int giveLastPoint(int elem) const { return elementOffsets [ elem + 1 ]; }
+    /// Returns the integration point with given index.
+    GaussPoint *givePoint(int i) const { return points [ i ]; }
+    /// Returns the global coordinates of point with given index.
+    const FloatArray &givePointCoordinates(int i) const { return coords [ i ]; }
+    /// Returns the volume associated to point with given index.
+    double givePointVolume(int i) const { return volumes [ i ]; }
+};
+
+
 /**
  * Abstract base class for all nonlocal materials. Nonlocal in sense, that response in particular
  * point depends not only on state in that point, but also takes into account state of surrounding
@@ -222,6 +285,9 @@ protected:
      */
     double px;
 
+    /// Grid of influencing integration points, built on the first request of nonlocal table.
+    std :: unique_ptr< NonlocalPointGrid >pointGrid;
+
 public:
     /**
      * Constructor. Creates material with given number, belonging to given domain.
@@ -259,6 +325,14 @@ public:
      */
     void buildNonlocalPointTable(GaussPoint *gp);
 
+    /**
+     * Returns the grid of influencing integration points, or NULL if the nonlocal tables have to be built
+     * using spatial localizer queries (tables are not kept or the support radius varies from point to point).
+     * The grid is created on first request, the tables of individual points can then be built
+     * concurrently during parallel assembly.
+     */
+    NonlocalPointGrid *giveNonlocalPointGrid();
+
     /**
      * Rebuild list of integration points which take part
      * in nonlocal average in given integration point.
@@ -274,7 +348,7 @@ public:
      * receiver's associated integration point.
      * Rebuilds the IP list by calling  buildNonlocalPointTable if not available.
      */
-    std :: list< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp);
+    std :: vector< localIntegrationRecord > *giveIPIntegrationList(GaussPoint *gp);
 
     /**
      * Evaluates the basic nonlocal weight function for a given distance
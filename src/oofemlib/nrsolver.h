@@ -43,6 +43,7 @@
 #include "sparsenonlinsystemnm.h"
 #include "sparsemtrx.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
 #include "linesearch.h"
 
 #include <memory>
@@ -67,6 +68,14 @@
 #define _IFT_NRSolver_constrainedNRminiter "constrainednrminiter"
 #define _IFT_NRSolver_followerLoad "followerload"
 #define _IFT_NRSolver_residuumNorm "rn"
+#define _IFT_NRSolver_matrixFree "matrixfree"
+#define _IFT_NRSolver_mfPrecond "mfprecond"
+#define _IFT_NRSolver_mfTol "mftol"
+#define _IFT_NRSolver_mfMaxIter "mfmaxiter"
+#define _IFT_NRSolver_mfRestart "mfrestart"
+#define _IFT_NRSolver_mfEpsilon "mfeps"
+#define _IFT_NRSolver_quasiNewton "quasinewton"
+#define _IFT_NRSolver_qnMemory "qnmemory"
 //@}
 
 namespace oofem {
@@ -94,6 +103,12 @@ class OOFEM_EXPORT NRSolver : public SparseNonLinearSystemNM
 {
 protected:
     enum nrsolver_ModeType { nrsolverModifiedNRM, nrsolverFullNRM, nrsolverAccelNRM };
+    /// Source of Jacobian-vector products in matrix-free (Newton-Krylov) mode.
+    enum nrsolver_MatrixFreeType { nrsolverMF_None, nrsolverMF_FiniteDifference, nrsolverMF_ElementKernel };
+    /// Preconditioner of matrix-free mode.
+    enum nrsolver_MFPrecondType { nrsolverMFP_None, nrsolverMFP_BlockDiagonal, nrsolverMFP_Assembled };
+    /// Quasi-Newton update of the last factorized tangent.
+    enum nrsolver_QuasiNewtonType { nrsolverQN_None, nrsolverQN_BFGS, nrsolverQN_Broyden };
 
     int nsmax, minIterations;
     double minStepLength;
@@ -155,6 +170,38 @@ protected:
     // If the follower load is applied, external forces need to be assembled in each itration
     bool followerLoadFlag;
     bool residuumNorm;    
+
+    /**
+     * Matrix-free mode. The linear systems are solved by restarted GMRES, the products with the tangent
+     * are obtained from finite differences of internal forces or from element kernels.
+     */
+    nrsolver_MatrixFreeType mfType;
+    /// Preconditioner of matrix-free mode.
+    nrsolver_MFPrecondType mfPrecond;
+    /// Relative tolerance of the Krylov solver.
+    double mfTol;
+    /// Maximum number of Krylov iterations and the restart length.
+    int mfMaxIter, mfRestart;
+    /// Relative size of finite difference perturbation.
+    double mfEpsilon;
+    /// Nodal blocks of equations (compressed storage), block index and position in block of equations.
+    IntArray mfBlockPtr, mfBlockEqs, mfBlockOf, mfPosInBlock;
+    /// Inverted diagonal blocks of the tangent.
+    std :: vector< FloatMatrix > mfBlockInverse;
+
+    /**
+     * Quasi-Newton mode. Between the updates of the tangent, limited-memory BFGS or Broyden updates
+     * of its inverse are applied, the tangent itself is used as the initial approximation.
+     */
+    nrsolver_QuasiNewtonType qnType;
+    /// Maximum number of stored updates.
+    int qnMemory;
+    /// Stored steps and corresponding changes of residual (BFGS) or update directions (Broyden).
+    std :: vector< FloatArray > qnS, qnY;
+    /// Reciprocal curvatures of the stored BFGS pairs.
+    std :: vector< double > qnRho;
+    /// Solution, residual and search direction of the previous iteration.
+    FloatArray qnLastX, qnLastRhs, qnLastDirection;
 public:
     NRSolver(Domain * d, EngngModel * m);
     virtual ~NRSolver();
@@ -189,6 +236,7 @@ public:
     }
 
     virtual SparseLinearSystemNM *giveLinearSolver();
+    virtual bool requiresAssembledMatrix() const { return mfType == nrsolverMF_None || mfPrecond == nrsolverMFP_Assembled; }
 
 protected:
     /// Constructs and returns a line search solver.
@@ -206,6 +254,38 @@ protected:
      */
     bool checkConvergence(FloatArray &RT, FloatArray &F, FloatArray &rhs, FloatArray &ddX, FloatArray &X,
                           double RRT, const FloatArray &internalForcesEBENorm, int nite, bool &errorOutOfRange);
+
+    /**
+     * Solves the linearized system in matrix-free mode by right-preconditioned restarted GMRES.
+     * @param k Matrix used for preconditioning (only when assembled preconditioner is used).
+     * @param rhs Right hand side.
+     * @param ddX Solution.
+     * @param X Total solution, temporarily perturbed when finite differences are used.
+     * @param dX Increment of solution, temporarily perturbed when finite differences are used.
+     * @param F Internal forces at X.
+     * @param tStep Solution step.
+     * @return Number of Krylov iterations.
+     */
+    int solveMatrixFree(SparseMtrx &k, const FloatArray &rhs, FloatArray &ddX, FloatArray &X, FloatArray &dX, FloatArray &F, TimeStep *tStep);
+    /// Computes the product of the tangent with v.
+    void computeJacobianTimesVector(FloatArray &answer, const FloatArray &v, FloatArray &X, FloatArray &dX, FloatArray &F, TimeStep *tStep);
+    /// Assembles and inverts the nodal diagonal blocks of the tangent.
+    void updateBlockDiagonalPreconditioner(TimeStep *tStep);
+    /// Applies the preconditioner of matrix-free mode.
+    void applyMatrixFreePreconditioner(SparseMtrx &k, const FloatArray &r, FloatArray &answer);
+
+    /**
+     * Computes the iterative increment of solution in quasi-Newton mode.
+     * The stored updates are discarded when the tangent has been updated.
+     * @param k Last tangent.
+     * @param rhs Residual.
+     * @param ddX Solution.
+     * @param X Total solution.
+     * @param tangentUpdated Flag indicating that the tangent has been updated in this iteration.
+     */
+    void solveQuasiNewton(SparseMtrx &k, FloatArray &rhs, FloatArray &ddX, const FloatArray &X, bool tangentUpdated);
+    /// Discards the stored quasi-Newton updates.
+    void resetQuasiNewton();
 };
 } // end namespace oofem
 #endif // nrsolver_h
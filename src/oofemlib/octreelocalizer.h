@@ -40,9 +40,8 @@
 #include "floatarray.h"
 #include "intarray.h"
 
-#include <set>
-#include <list>
 #include <vector>
+#include <utility>
 
 namespace oofem {
 class Domain;
@@ -56,121 +55,46 @@ class OctreeSpatialLocalizer;
 
 
 /**
- * Class representing the octant of octree.
- * It maintains the link to parent cell or if it it the root cell, this link pointer is set to NULL.
- * Maintains links to possible child octree cells as well as its position and size.
- * Also list of node numbers contained in given octree cell can be maintained if cell is terminal cell.
+ * Class representing the octant of linear octree.
+ * Octants are stored by value in a contiguous array maintained by OctreeSpatialLocalizer,
+ * the links to parent and children are indices into this array.
+ * The children of an octant are stored consecutively, in the order given by their local indices (i,j,k).
+ * Each octant owns a contiguous range of the node array of the localizer, the range of a
+ * parent octant is the union of its children ranges.
  */
 class OOFEM_NO_EXPORT OctantRec
 {
-protected:
-    /// Link to octree class.
-    OctreeSpatialLocalizer *localizer;
-    /// Link to parent cell record.
-    OctantRec *parent;
-    /// Link to octant children.
-    OctantRec *child [ 2 ] [ 2 ] [ 2 ];
-    /// Octant origin coordinates (lower corner)
-    FloatArray origin;
-    /// Octant size.
-    double halfWidth;
-    /// Tree depth
-    int depth;
-
-    /// Octant node list.
-    std :: list< int > nodeList;
-    /// Element list, containing all elements having IP in cell.
-    std :: set< int > elementIPList;
-    /// Element list of all elements close to the cell.
-    std :: vector< std :: list< int > >elementList;
-
 public:
     enum BoundingBoxStatus { BBS_OutsideCell, BBS_InsideCell, BBS_ContainsCell };
-    enum ChildStatus { CS_ChildFound, CS_NoChild };
+
+    /// Octant center coordinates.
+    double origin [ 3 ];
+    /// Half of the octant width.
+    double halfWidth;
+    /// Index of the parent octant, -1 for root.
+    int parent;
+    /// Index of the first child, -1 if octant is terminal.
+    int firstChild;
+    /// Tree depth.
+    int depth;
+    /// Range of octant nodes in node array of the localizer.
+    int nodeBegin, nodeEnd;
 
     /// Constructor.
-    OctantRec(OctreeSpatialLocalizer * loc, OctantRec * parent, FloatArray & origin, double halfWidth);
-    /// Destructor.
-    ~OctantRec();
+    OctantRec(const double center [ 3 ], double halfWidth, int parent, int depth, int nodeBegin, int nodeEnd);
 
-    /// @return Reference to parent; NULL if root.
-    OctantRec *giveParent() { return this->parent; }
-    /**
-     * Gives the cell origin.
-     * @param answer Cell origin.
-     */
-    const FloatArray & giveOrigin() { return this->origin; }
-    /// @return Half the cell width.
-    double giveWidth() { return 2. * this->halfWidth; }
-    /// @return Depth in the tree for this octant.
-    int giveCellDepth() { return this->depth; }
-    /**
-     * Gives the Child at given local indices.
-     * @param xi First index.
-     * @param yi Second index.
-     * @param zi Third index.
-     * @return Child cell with given local cell coordinates.
-     */
-    OctantRec *giveChild(int xi, int yi, int zi);
-    /**
-     * Returns the child containing given point.
-     * If not full 3d coordinates are provided, then only provided coordinates are taken into account,
-     * assuming remaining to be same as origin.
-     * If point is contained by receiver, corresponding child is set, otherwise.
-     * child is set to NULL.
-     * @param child
-     * @param coords Coordinate which child should contain.
-     * @return Child status.
-     */
-    ChildStatus giveChildContainingPoint(OctantRec **child, const FloatArray &coords);
     /// @return True if octant is terminal (no children).
-    bool isTerminalOctant();
-    /// @return Reference to node List.
-    std :: list< int > &giveNodeList();
-    /// @return Reference to IPelement set.
-    std :: set< int > &giveIPElementList();
-    /// @return Reference to closeElement list.
-    std :: list< int > &giveElementList(int region);
-
-    /**
-     * Divide receiver further, creating corresponding children.
-     * @param level Depth of tree.
-     * @param octantMask Masking of dimensions.
-     */
-    void divideLocally(int level, const IntArray &octantMask);
+    bool isTerminalOctant() const { return this->firstChild < 0; }
+    /// @return The cell width.
+    double giveWidth() const { return 2. * this->halfWidth; }
     /**
      * Test if receiver within bounding box (sphere).
      * @param coords Center of sphere.
      * @param radius Radius of sphere.
+     * @param octreeMask Masking of dimensions.
      * @return BoundingBoxStatus status.
      */
-    BoundingBoxStatus testBoundingBox(const FloatArray &coords, double radius);
-    /**
-     * Adds given element to cell list of elements having IP within this cell.
-     * @param elementNum Element number to add.
-     */
-    void addElementIP(int elementNum) { this->giveIPElementList().insert(elementNum); }
-    /**
-     * Adds given element to cell list of elements having IP within this cell.
-     * @param region Element region number (0 for global).
-     * @param elementNum Element number to add.
-     */
-    void addElement(int region, int elementNum) { this->giveElementList(region).push_back(elementNum); }
-    /**
-     * Adds given Node to node list of nodes contained by receiver.
-     * @param nodeNum Node number to add.
-     */
-    void addNode(int nodeNum) { this->giveNodeList().push_back(nodeNum); }
-    /**
-     * Clears and deletes the nodeList.
-     */
-    void deleteNodeList() {
-        nodeList.clear();
-    }
-    /// Recursively prints structure.
-    void printYourself();
-    /// Error printing helper.
-    std :: string errorInfo(const char *func) const { return std :: string("OctantRec") + func; }
+    BoundingBoxStatus testBoundingBox(const FloatArray &coords, double radius, const IntArray &octreeMask) const;
 };
 
 
@@ -181,14 +105,29 @@ public:
  * nodal connectivity informations provided by ConTable.
  * Typical services include searching the closes node to give position, searching of an element containing given point, etc.
  * If special element algorithms required, these should be included using interface concept.
+ *
+ * The tree is stored as a linear octree: octants, nodes and element lists are kept in contiguous arrays
+ * (the element lists of terminal octants in compressed row format) and the tree is built in bulk,
+ * level by level, by partitioning the node array in parallel. Queries traverse the tree using
+ * fixed size stacks, so that they do not allocate and can be evaluated concurrently.
  */
 class OOFEM_EXPORT OctreeSpatialLocalizer : public SpatialLocalizer
 {
 protected:
-    /// Root cell of octree.
-    OctantRec *rootCell;
+    /// Octants of the tree, the root cell is the first one.
+    std :: vector< OctantRec >octants;
     /// Octree degenerate mask.
     IntArray octreeMask;
+    /// Node numbers ordered by octants.
+    IntArray nodeItems;
+    /// Offsets of terminal octants into ipElementItems, elements of octant i are stored at [ipElementOffsets(i), ipElementOffsets(i+1)).
+    IntArray ipElementOffsets;
+    /// Elements having IP in terminal octants, sorted for each octant.
+    IntArray ipElementItems;
+    /// Offsets of terminal octants into elementItems, for each region.
+    std :: vector< IntArray >elementOffsets;
+    /// Elements with bounding box overlapping terminal octants, for each region.
+    std :: vector< IntArray >elementItems;
     /// Flag indicating elementIP tables are initialized.
     bool elementIPListsInitialized;
     IntArray elementListsInitialized;
@@ -196,7 +135,7 @@ protected:
 public:
     /// Constructor
     OctreeSpatialLocalizer(Domain * d);
-    /// Destructor - deletes the octree tree
+    /// Destructor
     virtual ~OctreeSpatialLocalizer();
 
     /**
@@ -224,6 +163,34 @@ public:
     virtual void giveAllNodesWithinBox(nodeContainerType &nodeList, const FloatArray &coords, const double radius);
     virtual Node * giveNodeClosestToPoint(const FloatArray &coords, double maxDist);
 
+    /**
+     * Returns the elements having integration point within given box.
+     * The answer is used as a buffer, it is cleared but its capacity is retained,
+     * so that repeated queries do not allocate.
+     * @param elemList Sorted numbers of elements meeting the criteria.
+     * @param coords Center of box of interest.
+     * @param radius Radius of bounding sphere.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
+     */
+    void giveAllElementsWithIpWithinBox_EvenIfEmpty(std :: vector< int > &elemList, const FloatArray &coords, const double radius, bool iCohesiveZoneGP = false);
+    /**
+     * Finds the elements containing given points, the points are processed in parallel.
+     * @param answer Elements containing the points, NULL if there is no such element.
+     * @param coords Coordinates of the points.
+     * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     */
+    void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords, const IntArray *regionList = NULL);
+    /**
+     * Finds the closest integration points to given points, the points are processed in parallel.
+     * @param answer Closest integration points.
+     * @param coords Coordinates of the points.
+     * @param region Region id of elements, 0 for all regions.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
+     */
+    void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, int region, bool iCohesiveZoneGP = false);
+    virtual void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords, const Set &eset);
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, Set &elemSet, bool iCohesiveZoneGP = false);
+
     virtual const char *giveClassName() const { return "OctreeSpatialLocalizer"; }
 
 protected:
@@ -237,65 +204,72 @@ protected:
     bool buildOctreeDataStructure();
     /**
      * Insert IP records into tree (the tree topology is determined by nodes).
-     * @return Nonzero if successful, otherwise zero.
      */
     void initElementIPDataStructure();
     /**
      * Insert element into tree (the tree topology is determined by nodes).
      */
     void initElementDataStructure(int region = 0);
+    /**
+     * Returns the index of child of given octant.
+     * @param cell Octant index.
+     * @param xi First index.
+     * @param yi Second index.
+     * @param zi Third index.
+     * @return Index of child cell with given local cell coordinates.
+     */
+    int giveChild(int cell, int xi, int yi, int zi) const
+    { return octants [ cell ].firstChild + ( xi * ( octreeMask.at(2) + 1 ) + yi ) * ( octreeMask.at(3) + 1 ) + zi; }
+    /// @return Number of children of non terminal octant.
+    int giveNumberOfChildren() const { return ( octreeMask.at(1) + 1 ) * ( octreeMask.at(2) + 1 ) * ( octreeMask.at(3) + 1 ); }
+    /**
+     * Returns the child containing given point.
+     * If not full 3d coordinates are provided, then only provided coordinates are taken into account,
+     * assuming remaining to be same as origin.
+     * @param cell Non terminal octant.
+     * @param coords Coordinate which child should contain.
+     * @return Index of child.
+     */
+    int giveChildContainingPoint(int cell, const FloatArray &coords) const;
     /**
      * Finds the terminal octant containing the given point.
      * @param startCell Cell used to start search.
      * @param coords Coordinates of point of interest.
-     * @return Pointer to terminal octant, NULL if point outside startingCell.
-     */
-    OctantRec *findTerminalContaining(OctantRec *startCell, const FloatArray &coords);
-    /**
-     * Inserts the given node (identified by its number and position) to the octree structure.
-     * The tree is traversed until terminal octant containing given position is found and node is then inserted
-     * into octant nodal list. If there is too much nodes per cell, this is subdivided further and
-     * its assigned nodes are propagated to children.
-     * @param rootCell Starting cell for insertion.
-     * @param nodeNum Node number.
-     * @param coords Corresponding node coordinates.
+     * @return Index of terminal octant.
      */
-    void insertNodeIntoOctree(OctantRec *rootCell, int nodeNum, const FloatArray &coords);
+    int findTerminalContaining(int startCell, const FloatArray &coords) const;
     /**
-     * Inserts the given integration point (or more precisely the element owning it) to the octree data structure.
-     * The tree is traversed until terminal octant containing given position (ip coordinates) is found
-     * and corresponding entry is then inserted into corresponding octant list.
-     * @param rootCell Starting cell for insertion.
-     * @param elemNum Element number.
-     * @param coords Global IP coordinates.
+     * Finds the smallest octant containing given box, starting from terminal octant containing its center.
+     * @param coords Center of box of interest.
+     * @param radius Radius of bounding sphere.
+     * @return Index of octant.
      */
-    void insertIPElementIntoOctree(OctantRec *rootCell, int elemNum, const FloatArray &coords);
+    int findOctantContainingBox(const FloatArray &coords, double radius) const;
     /**
      * Inserts an element with the given bounding box.
+     * @param items Pairs of (octant, element) the element is appended to.
      * @param rootCell Starting cell for insertion.
-     * @param region Element region number.
      * @param elemNum Element number.
      * @param b0 Lower bounding box.
      * @param b1 Upper bounding box.
      */
-    void insertElementIntoOctree(OctantRec *rootCell, int region, int elemNum, const FloatArray &b0, const FloatArray &b1);
+    void insertElementIntoOctree(std :: vector< std :: pair< int, int > > &items, int rootCell, int elemNum, const FloatArray &b0, const FloatArray &b1);
     /**
-     * Initializes the element lists  in octree data structure.
-     * This implementation requires that the list of nodes in terminate cells exists
-     * simply all shared elements to nodes in terminal cell are added.
-     * If this is added to existing implementation based on adding elements only if integration point is in the cell.
-     * this leads to more complete element list in terminal cell.
-     * @param rootCell Starting cell for octree transversal.
+     * Stores the (octant, item) pairs in compressed row format.
+     * @param offsets Offsets of octants into items.
+     * @param items Items, sorted for each octant, without duplicities.
+     * @param pairs Pairs of (octant, item), sorted on output.
      */
-    void insertElementsUsingNodalConnectivitiesIntoOctree(OctantRec *rootCell);
+    void compressOctantItems(IntArray &offsets, IntArray &items, std :: vector< std :: pair< int, int > > &pairs);
     /**
-     * Returns container (set) of elements having integration point within given box and given root cell.
-     * @param elemSet answer containing the list of elements meeting the criteria.
+     * Appends elements having integration point within given box and given root cell.
+     * @param elemList answer containing the list of elements meeting the criteria.
      * @param currentCell The starting cell to be transversed.
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
      */
-    void giveElementsWithIPWithinBox(elementContainerType &elemSet, OctantRec *currentCell,
+    void giveElementsWithIPWithinBox(std :: vector< int > &elemList, int currentCell,
                                      const FloatArray &coords, const double radius, bool iCohesiveZoneGP = false);
     /**
      * Returns container (list) of nodes within given box and given root cell.
@@ -304,52 +278,57 @@ protected:
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
      */
-    void giveNodesWithinBox(nodeContainerType &nodeList, OctantRec *currentCell,
+    void giveNodesWithinBox(nodeContainerType &nodeList, int currentCell,
                             const FloatArray &coords, const double radius);
-
     /**
-     * Returns closest IP to given point contained within given octree cell.
-     * @param currentCell Starting cell to search, all children will be searched too
+     * Updates the closest IP of given element.
+     * @param ielem Element to scan.
      * @param coords Point coordinates.
-     * @param region Region id of elements.
      * @param dist Threshold distance, only update answer param, if distance is smaller, distance is updated too.
      * @param answer Pointer to IP, which has the smallest distance "distance" from given point.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
+     * @param acceptEqual Determines if IP in the threshold distance replaces the answer.
      */
-    void giveClosestIPWithinOctant(OctantRec *currentCell, //elementContainerType& visitedElems,
-                                   const FloatArray &coords,
-                                   int region, double &dist, GaussPoint **answer, bool iCohesiveZoneGP);
+    void giveClosestIPOfElement(Element *ielem, const FloatArray &coords, double &dist, GaussPoint **answer, bool iCohesiveZoneGP, bool acceptEqual);
     /**
      * Returns closest IP to given point contained within given octree cell.
      * @param currentCell Starting cell to search, all children will be searched too
      * @param coords Point coordinates.
-     * @param elemSet set of considered elements.
+     * @param region Region id of elements.
+     * @param elemSet Set of considered elements, if NULL all elements of given region are considered.
      * @param dist Threshold distance, only update answer param, if distance is smaller, distance is updated too.
      * @param answer Pointer to IP, which has the smallest distance "distance" from given point.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
      */
-    void giveClosestIPWithinOctant(OctantRec *currentCell, //elementContainerType& visitedElems,
-                                   const FloatArray &coords,
-                                   Set &elemSet, double &dist, GaussPoint **answer, bool iCohesiveZoneGP);
+    void giveClosestIPWithinOctant(int currentCell, const FloatArray &coords, int region, const Set *elemSet,
+                                   double &dist, GaussPoint **answer, bool iCohesiveZoneGP);
+    /**
+     * Returns closest IP to given point.
+     * @param coords Point coordinates.
+     * @param region Region id of elements.
+     * @param elemSet Set of considered elements, if NULL all elements of given region are considered.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
+     */
+    GaussPoint *giveClosestIP(const FloatArray &coords, int region, const Set *elemSet, bool iCohesiveZoneGP);
     /**
      * Returns the element containing given point.
      * The search is done only for given cell and its children, skipping the given child from search
      * @param cell Top level cell to search.
      * @param coords Point coordinates.
-     * @param scannedChild Child pointer to exclude from search.
+     * @param scannedChild Child to exclude from search, -1 if none.
      * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     * @param elset Only elements in given set are considered, if NULL all elements are considered.
      * @note regions depreceted, use sets insteed
      */
-    Element *giveElementContainingPoint(OctantRec *cell, const FloatArray &coords,
-                                        OctantRec *scannedChild = NULL, const IntArray *regionList = NULL);
+    Element *giveElementContainingPoint(int cell, const FloatArray &coords, int scannedChild,
+                                        const IntArray *regionList, const Set *elset);
     /**
-     * Returns the element containing given point.
-     * The search is done only for given cell and its children, skipping the given child from search
-     * @param cell Top level cell to search.
+     * Returns the element containing given point, searching from terminal octant containing point towards the root.
      * @param coords Point coordinates.
-     * @param scannedChild Child pointer to exclude from search.
-     * @param elset Only elements in gibven set are considered, if NULL all regions are considered.
+     * @param regionList Only elements within given regions are considered, if NULL all regions are considered.
+     * @param elset Only elements in given set are considered, if NULL all elements are considered.
      */
-    Element *giveElementContainingPoint(OctantRec *cell, const FloatArray &coords,
-                                        OctantRec *scannedChild = NULL, const Set *elset = NULL);
+    Element *giveElementContainingPoint(const FloatArray &coords, const IntArray *regionList, const Set *elset);
     /**
      * Returns the element closest to the given point within the cell.
      * @param currCell Terminal cell to look in.
@@ -360,7 +339,7 @@ protected:
      * @param answer Requested element.
      * @param region Region to consider.
      */
-    void giveElementClosestToPointWithinOctant(OctantRec *currCell, const FloatArray &gcoords,
+    void giveElementClosestToPointWithinOctant(int currCell, const FloatArray &gcoords,
                                                double &minDist, FloatArray &lcoords, FloatArray &closest, Element * &answer, int region);
     /**
      * Returns the node closest to the given point within the cell.
@@ -369,26 +348,18 @@ protected:
      * @param[in,out] minDist Distance from the center of returned element.
      * @param answer Requested node.
      */
-    void giveNodeClosestToPointWithinOctant(OctantRec* cell, const FloatArray &gcoords, double &minDist, Node * &answer);
-    /**
-     * Determines the max tree depth computed for given tree cell and its children.
-     * To obtain total tree depth, root cell should be supplied.
-     * The tree depth is always measured from the root cell.
-     * Before call, maxDepth should be set to zero.
-     * @param root Root of tree.
-     * @param maxDepth The maximum depth in the tree.
-     */
-    void giveMaxTreeDepthFrom(OctantRec *root, int &maxDepth);
+    void giveNodeClosestToPointWithinOctant(int currCell, const FloatArray &gcoords, double &minDist, Node * &answer);
+    /// @return The max tree depth, measured from the root cell.
+    int giveMaxTreeDepth();
     /**
      * Builds the list of terminal cells contained within given box (coords, radius), starting from given currentCell.
-     * @param cellList List of terminal cell pointers contained by bounding box.
+     * @param cellList List of terminal cells contained by bounding box, cleared first.
      * @param coords Center of box of interest.
      * @param radius Radius of bounding sphere.
-     * @param innerRadius Inner radius of bounding sphere.
      * @param currentCell Starting cell.
      */
-    void giveListOfTerminalCellsInBoundingBox(std :: list< OctantRec * > &cellList, const FloatArray &coords,
-                                              const double radius, double innerRadius, OctantRec *currentCell);
+    void giveListOfTerminalCellsInBoundingBox(std :: vector< int > &cellList, const FloatArray &coords,
+                                              const double radius, int currentCell);
 };
 } // end namespace oofem
 #endif // octreelocalizer_h
@@ -0,0 +1,232 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef performancemonitor_h
+#define performancemonitor_h
+
+#include "oofemcfg.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///@name Report formats of PerformanceMonitor (bit flags).
+//@{
+#define PERF_REPORT_JSON 1
+#define PERF_REPORT_CSV 2
+//@}
+
+namespace oofem {
+/**
+ * Hierarchical profiling facility of engineering model.
+ * Time spent in individual phases of the solution (sections) is measured by PerformanceScope objects.
+ * Sections started while another one is active become its children, so the same section can appear
+ * in the report several times, at different places of the hierarchy (e.g. linear solve within nonlinear solve
+ * and within error estimation). Apart from timing, the monitor counts characteristic events
+ * (assembled elements, integration point updates, factorizations, ...).
+ *
+ * The values are collected for each solution step (step 0 corresponds to the initialization before the first step)
+ * and at the end of the analysis they are written into the report in JSON and/or CSV format.
+ * When the monitor is disabled (the default), the scopes and counters are reduced to a single test.
+ *
+ * The sections must not be entered from within parallel regions; the time of work done by threads is accumulated
+ * by the caller and added by addTime.
+ */
+class OOFEM_EXPORT PerformanceMonitor
+{
+public:
+    /// Monitored sections.
+    enum Section {
+        PMS_DomainSetup,
+        PMS_SolutionStep,
+        PMS_MatrixAssembly,
+        PMS_ElementMatrices,
+        PMS_SparseAssembly,
+        PMS_VectorAssembly,
+        PMS_BoundaryConditions,
+        PMS_NonlinearSolve,
+        PMS_ConvergenceCheck,
+        PMS_LinearSolve,
+        PMS_Factorization,
+        PMS_Output,
+        PMS_Export,
+        PMS_LastSection
+    };
+
+    /// Monitored counters.
+    enum Counter {
+        PMC_AssembledElements,
+        PMC_IPUpdates,
+        PMC_Factorizations,
+        PMC_SymbolicFactorizations,
+        PMC_LinearSolves,
+        PMC_NonlinearIterations,
+        PMC_LastCounter
+    };
+
+protected:
+    /// Node of section tree.
+    struct Node {
+        Section section;
+        /// Index of parent node (-1 for top level sections).
+        int parent;
+        /// Indices of child nodes.
+        std :: vector< int >children;
+        /// Time and number of calls in current step.
+        double stepTime;
+        long stepCalls;
+        /// Total time and number of calls.
+        double totalTime;
+        long totalCalls;
+    };
+
+    /// Record of one solution step.
+    struct StepRecord {
+        int step;
+        std :: vector< double >time;
+        std :: vector< long >calls;
+        long counters [ PMC_LastCounter ];
+    };
+
+    /// Report format flags (see PERF_REPORT_JSON and PERF_REPORT_CSV), zero if monitor is disabled.
+    int reportFormat;
+    /// Section tree.
+    std :: vector< Node >nodes;
+    /// Top level nodes.
+    std :: vector< int >roots;
+    /// Active node (-1 if none).
+    int current;
+    /// Counters in current step.
+    long stepCounters [ PMC_LastCounter ];
+    /// Total counters.
+    long totalCounters [ PMC_LastCounter ];
+    /// Records of finished steps.
+    std :: vector< StepRecord >steps;
+
+public:
+    PerformanceMonitor();
+    ~PerformanceMonitor() { }
+
+    /// Sets report format, nonzero value enables the monitor.
+    void setReportFormat(int format) { reportFormat = format; }
+    /// Returns true if monitor is enabled.
+    bool isEnabled() const { return reportFormat != 0; }
+
+    /**
+     * Starts given section as a child of currently active section.
+     * @return Node of started section, to be passed to leave.
+     */
+    int enter(Section s);
+    /**
+     * Stops the section started by enter.
+     * @param node Node returned by enter.
+     * @param time Time spent in section.
+     */
+    void leave(int node, double time);
+    /**
+     * Adds time to given section, as a child of currently active section.
+     * Used for work done in parallel regions, where the scopes cannot be used.
+     */
+    void addTime(Section s, double time, long calls = 1);
+    /// Increments given counter.
+    void count(Counter c, long n = 1) {
+        if ( reportFormat ) {
+            stepCounters [ c ] += n;
+        }
+    }
+
+    /// Closes the record of given solution step and starts new one.
+    void finishStep(int step);
+    /**
+     * Writes the report.
+     * @param baseName Base of file names, the extension corresponding to format is appended.
+     */
+    void writeReport(const std :: string &baseName);
+
+    /// Returns name of given section.
+    static const char *giveSectionName(Section s);
+    /// Returns name of given counter.
+    static const char *giveCounterName(Counter c);
+    /// Returns wall clock time in seconds, relative to arbitrary origin.
+    static double clock() {
+        return std :: chrono :: duration< double >( std :: chrono :: steady_clock :: now().time_since_epoch() ).count();
+    }
+
+protected:
+    /// Returns path of given node (names of sections separated by '/').
+    std :: string givePath(int node) const;
+    void writeJSON(FILE *file);
+    void writeCSV(FILE *file);
+};
+
+/**
+ * Measures the time spent in the block of code it is created in.
+ * The section is started by constructor and stopped by destructor.
+ * Monitor can be NULL, then nothing is measured.
+ */
+class OOFEM_EXPORT PerformanceScope
+{
+protected:
+    PerformanceMonitor *monitor;
+    int node;
+    double start;
+
+public:
+    PerformanceScope(PerformanceMonitor *m, PerformanceMonitor :: Section s) : monitor(NULL), node(-1), start(0.)
+    {
+        if ( m && m->isEnabled() ) {
+            monitor = m;
+            node = m->enter(s);
+            start = PerformanceMonitor :: clock();
+        }
+    }
+    /// Starts given section and increments given counter.
+    PerformanceScope(PerformanceMonitor *m, PerformanceMonitor :: Section s, PerformanceMonitor :: Counter c) :
+        PerformanceScope(m, s)
+    {
+        if ( monitor ) {
+            monitor->count(c);
+        }
+    }
+    ~PerformanceScope()
+    {
+        if ( monitor ) {
+            monitor->leave(node, PerformanceMonitor :: clock() - start);
+        }
+    }
+};
+} // end namespace oofem
+#endif // performancemonitor_h
@@ -112,6 +112,16 @@ public:
 
     virtual const char *giveClassName() const { return "PrescribedGradient"; }
     virtual const char *giveInputRecordName() const { return _IFT_PrescribedGradient_Name; }
+
+protected:
+    /**
+     * Computes the same tangent as computeTangent without the rectangular sparse matrices, which only PETSc provides.
+     * Only the free-free block is assembled and factorized, the products with the blocks of prescribed unknowns
+     * are evaluated element by element.
+     * @param tangent Output tangent.
+     * @param tStep Active time step.
+     */
+    void computeTangentByElements(FloatMatrix &tangent, TimeStep *tStep);
 };
 } // end namespace oofem
 
@@ -93,6 +93,7 @@ public:
 
     virtual void times(const FloatArray &x, FloatArray &answer) const;
     virtual void timesT(const FloatArray &x, FloatArray &answer) const { this->times(x, answer); }
+    virtual void times(const FloatMatrix &B, FloatMatrix &answer) const;
     virtual void times(double x);
     virtual void add(double x, SparseMtrx &m);
     virtual int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &);
@@ -109,11 +110,20 @@ public:
 
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    virtual bool computeScatterMap(IntArray &map, const IntArray &loc) const;
+    virtual void assembleScattered(const IntArray &map, const FloatMatrix &mat);
 
+    virtual bool canBeAssembledConcurrently() const { return true; }
     virtual bool canBeFactorized() const { return true; }
     virtual SparseMtrx *factorized();
     virtual FloatArray *backSubstitutionWith(FloatArray &) const;
+    virtual void backSubstitutionWith(FloatMatrix &y) const;
     virtual void zero();
+    /**
+     * Returns the number of negative pivots of the factorized receiver. By Sylvester's law of inertia,
+     * it equals to the number of negative eigenvalues of the receiver.
+     */
+    int giveNumberOfNegativePivots() const;
     /**
      * Splits the receiver to LDLT form,
      * and computes the rigid body motions.
@@ -87,6 +87,7 @@ public:
     int setInternalStructure(IntArray &a);
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    virtual bool canBeAssembledConcurrently() const { return true; }
     virtual bool canBeFactorized() const { return true; }
     virtual SparseMtrx *factorized();
     virtual FloatArray *backSubstitutionWith(FloatArray &) const;
@@ -39,12 +39,35 @@
 #include "nmstatus.h"
 #include "linsystsolvertype.h"
 #include "sparsemtrxtype.h"
+#include "sparsemtrx.h"
 
 namespace oofem {
 class EngngModel;
-class SparseMtrx;
+class PerformanceMonitor;
 class FloatArray;
 
+/**
+ * Statistics of factorizations performed by a linear solver.
+ * Solvers, which separate the symbolic phase (ordering, elimination tree, structure of factor or preconditioner)
+ * from the numeric one, repeat the symbolic phase only when the sparsity pattern of the matrix changes.
+ */
+struct OOFEM_EXPORT FactorizationStatistics {
+    /// Number of symbolic factorizations.
+    int nSymbolic;
+    /// Number of numeric factorizations.
+    int nNumeric;
+    /// Number of numeric factorizations, which reused previous symbolic factorization.
+    int nReused;
+    /// Total (wall) time of symbolic factorizations.
+    double symbolicTime;
+    /// Total (wall) time of numeric factorizations.
+    double numericTime;
+
+    FactorizationStatistics() : nSymbolic(0), nNumeric(0), nReused(0), symbolicTime(0.), numericTime(0.) { }
+    /// Returns estimated time saved by reusing symbolic factorizations.
+    double giveSavedTime() const { return nSymbolic ? nReused * symbolicTime / nSymbolic : 0.; }
+};
+
 /**
  * This base class is an abstraction for all numerical methods solving sparse
  * linear system of equations. The purpose of this class is to declare
@@ -57,6 +80,14 @@ class FloatArray;
  */
 class OOFEM_EXPORT SparseLinearSystemNM : public NumericalMethod
 {
+protected:
+    /// Matrix, for which the symbolic factorization was computed.
+    const SparseMtrx *symbolicLhs;
+    /// Structure version of symbolicLhs at the time of symbolic factorization.
+    SparseMtrx :: SparseMtrxVersionType symbolicStructureVersion;
+    /// Factorization statistics.
+    FactorizationStatistics factorizationStats;
+
 public:
     /// Constructor.
     SparseLinearSystemNM(Domain * d, EngngModel * m);
@@ -93,6 +124,37 @@ public:
      * Returns the recommended sparse matrix type for this solver.
      */
     virtual SparseMtrxType giveRecommendedMatrix(bool symmetric) const = 0;
+
+    /**
+     * Checks whether the sparsity pattern of given matrix is the same as the pattern of last symbolic
+     * factorization of receiver. If so, only the numeric phase has to be repeated when the values change.
+     * @param A Coefficient matrix.
+     * @return True if symbolic factorization of A can be reused.
+     */
+    virtual bool isPatternUnchanged(const SparseMtrx &A) const
+    { return symbolicLhs == & A && symbolicStructureVersion == A.giveStructureVersion(); }
+    /// Invalidates symbolic factorization, the next solution is computed from scratch.
+    virtual void resetSymbolicFactorization() { symbolicLhs = NULL; }
+    /// Returns statistics of factorizations performed by receiver.
+    virtual const FactorizationStatistics &giveFactorizationStatistics() const { return factorizationStats; }
+    /// Prints factorization statistics to log.
+    void printFactorizationStatistics() const;
+
+protected:
+    /**
+     * Records symbolic factorization of given matrix.
+     * @param A Factorized matrix.
+     * @param time Time consumed by symbolic factorization.
+     */
+    void registerSymbolicFactorization(const SparseMtrx &A, double time);
+    /**
+     * Records numeric factorization.
+     * @param time Time consumed by numeric factorization.
+     * @param reused True if previous symbolic factorization has been reused.
+     */
+    void registerNumericFactorization(double time, bool reused);
+    /// Returns performance monitor of associated engineering model (NULL if none).
+    PerformanceMonitor *givePerformanceMonitor();
 };
 } // end namespace oofem
 #endif // sparselinsystemnm_h
@@ -42,6 +42,10 @@
 #include "error.h"
 #include "sparsemtrxtype.h"
 
+#include <vector>
+#include <algorithm>
+#include <atomic>
+
 namespace oofem {
 class EngngModel;
 class TimeStep;
@@ -78,20 +82,36 @@ protected:
      * matrix, if there is no change;
      */
     SparseMtrxVersionType version;
+    /**
+     * Identifies the sparsity pattern of receiver. It is changed to a new value, unique among all matrices,
+     * whenever the internal structure of receiver is (re)built or new entries are inserted. Values can change
+     * freely without affecting it. Solvers use it to detect unchanged pattern and to reuse their symbolic
+     * factorization (ordering, elimination tree, structure of factor) for numeric refactorization.
+     */
+    SparseMtrxVersionType structureVersion;
+    /// Flag indicating concurrent assembly, during which the version is not changed, see beginConcurrentAssembly.
+    bool concurrentAssembly;
+
+    /// Location arrays, for which the cached scatter maps were computed (one per slot).
+    std :: vector< IntArray > scatterLocs;
+    /// Cached scatter maps (one per slot), see computeScatterMap.
+    std :: vector< IntArray > scatterMaps;
 
 public:
     /**
      * Constructor, creates (n,m) sparse matrix. Due to sparsity character of matrix,
      * not all coefficient are physically stored (in general, zero members are omitted).
      */
-    SparseMtrx(int n, int m) : nRows(n), nColumns(m), version(0) { }
+    SparseMtrx(int n, int m) : nRows(n), nColumns(m), version(0), concurrentAssembly(false) { this->newStructureVersion(); }
     /// Constructor
-    SparseMtrx() : nRows(0), nColumns(0), version(0) { }
+    SparseMtrx() : nRows(0), nColumns(0), version(0), concurrentAssembly(false) { this->newStructureVersion(); }
     /// Destructor
     virtual ~SparseMtrx() { }
 
     /// Return receiver version.
     SparseMtrxVersionType giveVersion() { return this->version; }
+    /// Returns version of sparsity pattern of receiver, see structureVersion.
+    SparseMtrxVersionType giveStructureVersion() const { return this->structureVersion; }
 
     /**
      * Checks size of receiver towards requested bounds.
@@ -146,7 +166,16 @@ public:
      * @param B Array to be multiplied with receiver.
      * @param answer C.
      */
-    virtual void times(const FloatMatrix &B, FloatMatrix &answer) const { OOFEM_ERROR("Not implemented"); }
+    virtual void times(const FloatMatrix &B, FloatMatrix &answer) const {
+        // default implementation multiplies the columns one by one
+        FloatArray x, y;
+        answer.resize( this->giveNumberOfRows(), B.giveNumberOfColumns() );
+        for ( int j = 1; j <= B.giveNumberOfColumns(); j++ ) {
+            x.beColumnOf(B, j);
+            this->times(x, y);
+            answer.setColumn(y, j);
+        }
+    }
     /**
      * Evaluates @f$ C = A^{\mathrm{T}} \cdot B @f$
      * @param B Matrix to be multiplied with receiver.
@@ -223,11 +252,98 @@ public:
      */
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat) = 0;
 
+    /**
+     * Computes the scatter map of a local contribution, i.e. the positions of its coefficients
+     * (in column-wise order of FloatMatrix) in the value storage of receiver. Negative position
+     * denotes coefficient, which is not assembled. Scatter maps remain valid until the internal structure
+     * of receiver is rebuilt.
+     * @param map Scatter map.
+     * @param loc Location array of contribution.
+     * @return False if receiver doesn't support assembling through scatter maps.
+     */
+    virtual bool computeScatterMap(IntArray &map, const IntArray &loc) const { return false; }
+    /**
+     * Assembles local contribution using scatter map, avoiding any search in the sparse structure.
+     * @param map Scatter map computed by computeScatterMap.
+     * @param mat Contribution to be assembled.
+     */
+    virtual void assembleScattered(const IntArray &map, const FloatMatrix &mat) { OOFEM_ERROR("Not implemented"); }
+    /**
+     * Resizes the cache of scatter maps to given number of slots (typically number of elements).
+     * Must be called before the cache is used from several threads.
+     */
+    void initScatterMapCache(int nslots) {
+        scatterLocs.resize(nslots);
+        scatterMaps.resize(nslots);
+    }
+    /**
+     * Marks the sparsity pattern of receiver as changed; to be called when the internal structure is rebuilt.
+     * The counter is shared by all matrices, which may be created concurrently (e.g. by subscale problems).
+     */
+    void newStructureVersion() {
+        static std :: atomic< SparseMtrxVersionType >lastStructureVersion(0);
+        this->structureVersion = ++lastStructureVersion;
+    }
+    /// Increments version of receiver after its values have been changed by assembling, unless assembled concurrently.
+    void incrementVersion() {
+        if ( !this->concurrentAssembly ) {
+            this->version++;
+        }
+    }
+    /// Drops all cached scatter maps; to be called when the internal structure is rebuilt.
+    void clearScatterMapCache() {
+        scatterLocs.clear();
+        scatterMaps.clear();
+    }
+    /**
+     * Assembles local contribution using scatter map cached in given slot. The map is (re)computed only
+     * when the location array differs from the one it was computed for. Concurrent calls must use different slots.
+     * Falls back to assemble(loc, mat) if receiver doesn't support scatter maps or slot is out of cache size.
+     * @param slot Cache slot (typically element number).
+     * @param loc Location array.
+     * @param mat Contribution to be assembled.
+     * @return Nonzero if successful.
+     */
+    int assembleCached(int slot, const IntArray &loc, const FloatMatrix &mat) {
+        if ( slot < 1 || slot > (int)scatterMaps.size() ) {
+            return this->assemble(loc, mat);
+        }
+        IntArray &map = scatterMaps [ slot - 1 ];
+        IntArray &mapLoc = scatterLocs [ slot - 1 ];
+        if ( map.isEmpty() || mapLoc.giveSize() != loc.giveSize() || !std :: equal( loc.begin(), loc.end(), mapLoc.begin() ) ) {
+            if ( !this->computeScatterMap(map, loc) ) {
+                map.clear();
+                return this->assemble(loc, mat);
+            }
+            mapLoc = loc;
+        }
+        this->assembleScattered(map, mat);
+        return 1;
+    }
+
     /// Starts assembling the elements.
     virtual int assembleBegin() { return 1; }
     /// Returns when assemble is completed.
     virtual int assembleEnd() { return 1; }
 
+    /**
+     * Determines, whether assemble may be called concurrently from several threads,
+     * provided that the location arrays of the concurrent calls are disjoint.
+     * This holds for formats with a static structure, where assembling only updates existing values.
+     * The concurrent calls must be enclosed by beginConcurrentAssembly and endConcurrentAssembly.
+     */
+    virtual bool canBeAssembledConcurrently() const { return false; }
+    /**
+     * Starts concurrent assembly. Until endConcurrentAssembly is called, assembling does not change
+     * the version of receiver, so that concurrent calls write only to the (disjoint) values.
+     */
+    void beginConcurrentAssembly() { this->concurrentAssembly = true; }
+    /// Ends concurrent assembly and increments the version of receiver once for all assembled contributions.
+    void endConcurrentAssembly() {
+        this->concurrentAssembly = false;
+        this->version++;
+    }
+
     /// Determines, whether receiver can be factorized.
     virtual bool canBeFactorized() const = 0;
     /**
@@ -243,6 +359,20 @@ public:
      * @return Pointer to y array.
      */
     virtual FloatArray *backSubstitutionWith(FloatArray &y) const { return NULL; }
+    /**
+     * Computes the solutions of linear systems @f$ A\cdot X = Y @f$ with several right hand sides at once.
+     * Solution X overwrites the right hand sides Y. Receiver must be in factorized form.
+     * Default implementation solves the systems one by one.
+     * @param y Right hand sides (columns) on input, solutions on output.
+     */
+    virtual void backSubstitutionWith(FloatMatrix &y) const {
+        FloatArray x;
+        for ( int j = 1; j <= y.giveNumberOfColumns(); j++ ) {
+            x.beColumnOf(y, j);
+            this->backSubstitutionWith(x);
+            y.setColumn(x, j);
+        }
+    }
     /// Zeroes the receiver.
     virtual void zero() = 0;
 
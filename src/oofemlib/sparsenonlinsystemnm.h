@@ -153,6 +153,13 @@ public:
      */
     virtual SparseLinearSystemNM *giveLinearSolver() { return NULL; }
 
+    /**
+     * Returns true if the coefficient matrix passed to solve has to be assembled by the engineering model.
+     * Matrix-free methods obtain the products with the matrix in other way, so the engineering model
+     * does not need to allocate nor assemble it.
+     */
+    virtual bool requiresAssembledMatrix() const { return true; }
+
     IRResultType initializeFrom(InputRecord *ir);
     virtual void convertPertMap();
     virtual void applyPerturbation(FloatArray* displacement);
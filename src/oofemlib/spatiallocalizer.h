@@ -43,6 +43,7 @@
 
 #include <set>
 #include <list>
+#include <vector>
 
 namespace oofem {
 class Domain;
@@ -175,6 +176,23 @@ public:
      * are taken into account), NULL otherwise
      */
     virtual GaussPoint *giveClosestIP(const FloatArray &coords, Set &elemSet, bool iCohesiveZoneGP = false) = 0;
+    /**
+     * Returns the elements containing given points, see giveElementContainingPoint.
+     * Localizers which can answer queries concurrently process the points in parallel.
+     * @param answer Elements containing the points, NULL for points not found.
+     * @param coords Global problem coordinates of points of interest.
+     * @param eset Only elements within given set are considered.
+     */
+    virtual void giveElementsContainingPoints(std :: vector< Element * > &answer, const std :: vector< FloatArray > &coords, const Set &eset);
+    /**
+     * Returns the integration points closest to given points, see giveClosestIP.
+     * Localizers which can answer queries concurrently process the points in parallel.
+     * @param answer Closest integration points, NULL for points not found.
+     * @param coords Global problem coordinates of points of interest.
+     * @param elemSet Only integration points of elements within given set are considered.
+     * @param iCohesiveZoneGP Determines if cohesive zone IPs are considered instead of the default ones.
+     */
+    virtual void giveClosestIPs(std :: vector< GaussPoint * > &answer, const std :: vector< FloatArray > &coords, Set &elemSet, bool iCohesiveZoneGP = false);
 
     /**
      * Returns container (set) of all domain elements having integration point within given box.
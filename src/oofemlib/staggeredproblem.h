@@ -36,6 +36,7 @@
 #define staggeredproblem_h
 
 #include "engngm.h"
+#include "timestepcontroller.h"
 #include "inputrecord.h"
 #include "floatarray.h"
 
@@ -52,11 +53,6 @@
 #define _IFT_StaggeredProblem_prob2 "prob2"
 #define _IFT_StaggeredProblem_prob3 "prob3"
 #define _IFT_StaggeredProblem_coupling "coupling"
-#define _IFT_StaggeredProblem_adaptiveStepLength "adaptivesteplength"
-#define _IFT_StaggeredProblem_minsteplength "minsteplength"
-#define _IFT_StaggeredProblem_maxsteplength "maxsteplength"
-#define _IFT_StaggeredProblem_reqiterations "reqiterations"
-#define _IFT_StaggeredProblem_endoftimeofinterest "endoftimeofinterest"
 #define _IFT_StaggeredProblem_adaptivestepsince "adaptivestepsince"
 //@}
 
@@ -117,20 +113,16 @@ protected:
 
     /// List of slave models to which this model is coupled
     IntArray coupledModels;
-    bool adaptiveStepLength;
-    /// adaptive time step length - minimum
-    double minStepLength;
-    /// adaptive time step length - maximum
-    double maxStepLength;
-    /// adaptive time step length - required (=optimum) number of iterations 
-    double reqIterations;
-    /// adaptive time step length applies after prescribed time
-    double adaptiveStepSince;
     /**
-     * alternative overriding the number of steps "nsteps" - necessary for time-driven analyses when
+     * Adaptive time step length, driven by the number of iterations of slave problems. Its end of time of interest
+     * overrides the number of steps "nsteps" - necessary for time-driven analyses when
      * the appropriate number of steps is apriori unknow. If used, set "nsteps" to a high number e.g. 100000000
+     * Unlike in NonLinearStatic, a step which fails to converge is not cut and solved again, as the slaves
+     * solved before the failing one would have to be rolled back to the previous step.
      */
-    double endOfTimeOfInterest;
+    TimeStepController stepController;
+    /// adaptive time step length applies after prescribed time
+    double adaptiveStepSince;
 
     double prevStepLength;
     double currentStepLength;
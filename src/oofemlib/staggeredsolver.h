@@ -52,6 +52,7 @@
 #define _IFT_StaggeredSolver_Name "staggeredsolver"
 #define _IFT_StaggeredSolver_DofIdList "dofidlist"
 #define _IFT_StaggeredSolver_DofIdListPositions "idpos"
+#define _IFT_StaggeredSolver_andersonDepth "andersondepth"
 //@}
 
 namespace oofem {
@@ -79,7 +80,13 @@ private:
     std :: vector< FloatArray > ddX;
     std :: vector< FloatArray > dX;
     std :: vector< FloatArray > X;
-    
+
+    /// Number of previous staggered iterations used by Anderson acceleration (0 = no acceleration).
+    int andersonDepth;
+    /// Differences of the results of staggered iterations and of their residuals.
+    std :: vector< FloatArray > aaDeltaG, aaDeltaF;
+    /// Result and residual of the previous staggered iteration.
+    FloatArray aaLastG, aaLastF;
 
     void giveTotalLocationArray(IntArray &locationArray, const UnknownNumberingScheme &s, Domain *d);
     bool checkConvergenceDofIdArray(FloatArray &RT, FloatArray &F, FloatArray &rhs, FloatArray &ddX, FloatArray &X,
@@ -87,12 +94,20 @@ private:
 
     void instanciateYourself();
 
+    /**
+     * Applies Anderson acceleration to the fixed point iteration formed by one sweep over all dof groups.
+     * @param Xtotal Total solution after the sweep, replaced by the accelerated one.
+     * @param dXtotal Increment of total solution, updated accordingly.
+     * @param Xsweep Total solution at the beginning of the sweep.
+     */
+    void applyAndersonAcceleration(FloatArray &Xtotal, FloatArray &dXtotal, const FloatArray &Xsweep);
+
 public:
     StaggeredSolver(Domain * d, EngngModel * m);
     virtual ~StaggeredSolver() {}
 
     // Overloaded methods:
-    virtual NM_Status solve(SparseMtrx &k, FloatArray &R, FloatArray *R0, FloatArray *iR,
+    virtual NM_Status solve(SparseMtrx &k, FloatArray &R, FloatArray *R0,
                             FloatArray &X, FloatArray &dX, FloatArray &F,
                             const FloatArray &internalForcesEBENorm, double &l, referenceLoadInputModeType rlm,
                             int &nite, TimeStep *);
@@ -205,6 +205,18 @@ public:
 
         virtual int evaluateLongestEdge() { return 0; }
         virtual void bisect(std :: queue< int > &subdivqueue, std :: list< int > &sharedIrregularsQueue) { }
+        /**
+         * Returns true if bisection of receiver can be split into creation of irregular node (createIrregular),
+         * which does not modify the mesh, and its insertion into mesh (insertIrregular).
+         * Irregulars of such elements on distinct longest edges are created concurrently, see Subdivision :: bisectQueue.
+         */
+        virtual bool hasConcurrentBisection() { return false; }
+        /// Creates irregular node with given number on the longest edge of receiver, the mesh is not modified.
+        virtual RS_IrregularNode *createIrregular(int iNum) { return NULL; }
+        /// Inserts irregular node created by createIrregular into mesh and schedules the neighbour for bisection.
+        virtual void insertIrregular(RS_IrregularNode *irregular, std :: queue< int > &subdivqueue, std :: list< int > &sharedIrregularsQueue) { }
+        /// Returns true if longest edge of receiver is the longest edge of given element as well.
+        virtual bool sharesLongestEdgeWith(Subdivision :: RS_Element *elem) { return false; }
         virtual void generate(std :: list< int > &sharedEdgesQueue) { }
         virtual void update_neighbours() { }
         virtual double giveDensity() { return 0.0; }
@@ -256,6 +268,10 @@ public:
         RS_Triangle(int number, Subdivision :: RS_Mesh * mesh, int parent, IntArray & nodes);
         int evaluateLongestEdge();
         void bisect(std :: queue< int > &subdivqueue, std :: list< int > &sharedIrregularsQueue);
+        bool hasConcurrentBisection() { return true; }
+        RS_IrregularNode *createIrregular(int iNum);
+        void insertIrregular(RS_IrregularNode *irregular, std :: queue< int > &subdivqueue, std :: list< int > &sharedIrregularsQueue);
+        bool sharesLongestEdgeWith(Subdivision :: RS_Element *elem);
         void generate(std :: list< int > &sharedEdgesQueue);
         void update_neighbours();
         double giveDensity();
@@ -423,6 +439,12 @@ public:
 protected:
     Subdivision :: RS_Mesh *giveMesh() { return mesh; }
     void bisectMesh();
+    /**
+     * Processes the subdivision queue in rounds. Elements of one round, whose longest edges carry no irregular yet,
+     * form an independent set of longest edge bisections; their irregulars are created concurrently
+     * and then inserted in queue order, so that the resulting mesh does not depend on the number of threads.
+     */
+    void bisectQueue();
     void smoothMesh();
 
     bool isNodeLocalIrregular(Subdivision :: RS_Node *node, int myrank);
@@ -0,0 +1,162 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef supernodalsolver_h
+#define supernodalsolver_h
+
+#include "sparselinsystemnm.h"
+#include "sparsemtrx.h"
+#include "floatarray.h"
+
+#include <vector>
+#include <cstddef>
+
+///@name Input fields for SupernodalSolver
+//@{
+#define _IFT_SupernodalSolver_ordering "lsordering"
+//@}
+
+namespace oofem {
+class Domain;
+class EngngModel;
+class SymCompCol;
+
+/**
+ * Built-in direct solver based on supernodal multifrontal LDL^T factorization of symmetric matrices
+ * stored in SymCompCol format.
+ *
+ * The solution consists of symbolic and numeric phase. The symbolic phase computes fill reducing ordering
+ * (using orderings of DSS module, approximate minimum degree by default), elimination tree,
+ * its postordering and the structure of fundamental supernodes. The numeric phase traverses the
+ * supernodal assembly tree; the frontal matrix of each supernode is assembled from the original entries
+ * and the update matrices of its children, its pivot columns are factorized by dense kernels and the
+ * resulting update matrix is passed to the parent. Independent subtrees are processed concurrently
+ * (OpenMP tasks), when compiled with OpenMP support.
+ *
+ * The factorization is kept and reused as long as the same matrix with the same version is solved.
+ * The symbolic phase is repeated only when the sparsity pattern of the matrix changes
+ * (see SparseMtrx :: giveStructureVersion), refactorization of updated values costs the numeric phase only.
+ * No pivoting is performed, the matrix is assumed to be symmetric and to admit LDL^T factorization
+ * (same assumption as Skyline).
+ * Matrices of other types are solved using their own factorization, if supported.
+ */
+class OOFEM_EXPORT SupernodalSolver : public SparseLinearSystemNM
+{
+protected:
+    /// Type of fill reducing ordering (values of DSS Ordering :: Type).
+    int orderingType;
+
+    /// Last factorized matrix.
+    SparseMtrx *lhs;
+    /// Version of last factorized matrix.
+    SparseMtrx :: SparseMtrxVersionType lhsVersion;
+    /// Flag indicating valid factorization of lhs.
+    bool factorized;
+
+    /// Number of equations.
+    int neq;
+    /// Permutation, perm[i] is the new position of original equation i.
+    std :: vector< int >perm;
+    /// Column pointers of lower part of permuted matrix.
+    std :: vector< int >pColPtr;
+    /// Row indices of lower part of permuted matrix (sorted in each column).
+    std :: vector< int >pRowInd;
+    /// Positions of the entries of permuted matrix in the value array of original matrix.
+    std :: vector< int >pValMap;
+
+    /// First column of each supernode (size is number of supernodes + 1).
+    std :: vector< int >superPtr;
+    /// Parent of each supernode in the assembly tree (-1 for roots).
+    std :: vector< int >superParent;
+    /// First supernode of subtree rooted in each supernode (subtrees are contiguous in postorder).
+    std :: vector< int >subtreeStart;
+    /// Estimated number of operations needed to factorize subtree rooted in each supernode.
+    std :: vector< double >subtreeWork;
+    /// Children of supernodes (childList [ childPtr [ s ] ... childPtr [ s + 1 ] - 1 ]).
+    std :: vector< int >childPtr, childList;
+    /// Row structure of supernodes (starts with supernode columns).
+    std :: vector< int >superRowPtr, superRowInd;
+    /// Offsets of dense blocks of supernodes in factor.
+    std :: vector< std :: size_t >factorPtr;
+    /// Dense blocks of factor, stored column wise, unit lower triangle with D on diagonal.
+    std :: vector< double >factor;
+    /// Update matrices passed from supernodes to their parents during numeric factorization.
+    std :: vector< std :: vector< double > >updates;
+
+public:
+    /// Constructor - creates new instance of SupernodalSolver, belonging to domain d and Engngmodel m.
+    SupernodalSolver(Domain * d, EngngModel * m);
+    /// Destructor
+    virtual ~SupernodalSolver();
+
+    virtual IRResultType initializeFrom(InputRecord *ir);
+
+    /**
+     * Solves the given linear system by supernodal LDL^T factorization.
+     * Factorization is performed only when A or its version differ from last factorized matrix,
+     * the symbolic factorization is reused if the pattern of A is unchanged.
+     * @param A Coefficient matrix.
+     * @param b Right hand side.
+     * @param x Solution array.
+     * @return NM_Status value.
+     */
+    virtual NM_Status solve(SparseMtrx &A, FloatArray &b, FloatArray &x);
+
+    virtual const char *giveClassName() const { return "SupernodalSolver"; }
+    virtual LinSystSolverType giveLinSystSolverType() const { return ST_Supernodal; }
+    virtual SparseMtrxType giveRecommendedMatrix(bool symmetric) const { return symmetric ? SMT_SymCompCol : SMT_SkylineU; }
+
+    /// Returns number of nonzero entries of factor (including diagonal).
+    std :: size_t giveFactorSize() const;
+    /// Returns number of supernodes.
+    int giveNumberOfSupernodes() const { return superPtr.empty() ? 0 : ( int ) superPtr.size() - 1; }
+
+protected:
+    /// Computes ordering, elimination tree and supernodal structure of given matrix.
+    void symbolicFactorization(const SymCompCol &A);
+    /**
+     * Computes numerical factorization, symbolic factorization has to be available.
+     * @return True if successful, false if zero pivot encountered.
+     */
+    bool numericFactorization(const SymCompCol &A);
+    /// Factorizes subtree of assembly tree rooted in supernode s.
+    void factorizeSubtree(const SymCompCol &A, int s, bool &success);
+    /// Assembles frontal matrix of supernode s, factorizes its pivot block and computes its update matrix.
+    bool factorizeSupernode(const SymCompCol &A, int s);
+    /// Solves the system using computed factorization, answer contains right hand side on input.
+    void backSubstitutionWith(FloatArray &answer) const;
+};
+} // end namespace oofem
+#endif // supernodalsolver_h
@@ -107,6 +107,8 @@ public:
     virtual int buildInternalStructure(EngngModel *, int, const UnknownNumberingScheme &);
     virtual int assemble(const IntArray &loc, const FloatMatrix &mat);
     virtual int assemble(const IntArray &rloc, const IntArray &cloc, const FloatMatrix &mat);
+    virtual bool computeScatterMap(IntArray &map, const IntArray &loc) const;
+    virtual void assembleScattered(const IntArray &map, const FloatMatrix &mat);
     virtual bool canBeFactorized() const { return false; }
     virtual void zero();
     virtual double &at(int i, int j);
@@ -0,0 +1,114 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef timestepcontroller_h
+#define timestepcontroller_h
+
+#include "oofemcfg.h"
+#include "inputrecord.h"
+
+///@name Input fields for TimeStepController
+//@{
+#define _IFT_TimeStepController_adaptiveStepLength "adaptivesteplength"
+#define _IFT_TimeStepController_minStepLength "minsteplength"
+#define _IFT_TimeStepController_maxStepLength "maxsteplength"
+#define _IFT_TimeStepController_reqIterations "reqiterations"
+#define _IFT_TimeStepController_endOfTimeOfInterest "endoftimeofinterest"
+#define _IFT_TimeStepController_stepCutFactor "stepcutfactor"
+#define _IFT_TimeStepController_maxStepCuts "maxstepcuts"
+#define _IFT_TimeStepController_timeErrorTolerance "timeerrtol"
+//@}
+
+namespace oofem {
+/**
+ * Adaptive control of the time step length, shared by engineering models with adaptive time stepping.
+ * The length of the next step is derived from the number of iterations needed by the last converged step
+ * (the step grows when fewer than required iterations were needed and shrinks otherwise) and optionally
+ * from an estimate of the temporal discretization error. A step which failed to converge is cut and repeated
+ * by the engineering model.
+ */
+class OOFEM_EXPORT TimeStepController
+{
+protected:
+    /// Flag indicating that the adaptive step length is used.
+    bool active;
+    /// Minimum and maximum step length.
+    double minStepLength, maxStepLength;
+    /// Required (=optimum) number of iterations.
+    double reqIterations;
+    /// Time where the analysis ends, overrides the number of steps.
+    double endOfTimeOfInterest;
+    /// Factor reducing the length of a failed step.
+    double stepCutFactor;
+    /// Maximum number of cuts of one step.
+    int maxStepCuts;
+    /// Tolerance of the estimated relative temporal error (zero means no error control).
+    double timeErrorTolerance;
+
+public:
+    TimeStepController();
+
+    /// Initializes the receiver from the record of the engineering model.
+    IRResultType initializeFrom(InputRecord *ir);
+
+    /// Returns true if the adaptive step length is used.
+    bool isActive() const { return active; }
+    double giveEndOfTimeOfInterest() const { return endOfTimeOfInterest; }
+    int giveMaxStepCuts() const { return maxStepCuts; }
+    double giveTimeErrorTolerance() const { return timeErrorTolerance; }
+    /// Returns class name of the receiver.
+    const char *giveClassName() const { return "TimeStepController"; }
+
+    /**
+     * Proposes the length of the next step.
+     * @param lastStepLength Length of the last converged step.
+     * @param nite Number of iterations of the last converged step.
+     * @param timeError Estimated relative temporal error of the last converged step (ignored if not positive).
+     * @return New step length.
+     */
+    double proposeStepLength(double lastStepLength, int nite, double timeError = 0.) const;
+    /**
+     * Gives the length of a repeated step, which failed to converge or whose temporal error exceeded the tolerance.
+     * @param stepLength Length of the failed step.
+     * @param timeError Estimated relative temporal error of the failed step (ignored if not positive).
+     * @return Reduced step length, zero if the step can not be reduced below the minimum step length.
+     */
+    double cutStepLength(double stepLength, double timeError = 0.) const;
+    /// Shortens the step starting at given time so that it ends at the end of time of interest.
+    double trimStepLength(double time, double stepLength) const;
+    /// Returns true if the end of time of interest has been reached.
+    bool isEndOfTimeOfInterestReached(double time) const;
+};
+} // end namespace oofem
+#endif // timestepcontroller_h
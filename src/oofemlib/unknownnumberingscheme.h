@@ -60,6 +60,12 @@ public:
      * for default numbering to avoid repeated evaluation.
      */
     virtual bool isDefault() const { return false; }
+    /**
+     * Returns true, if receiver gives exactly the equation numbers stored in dofs.
+     * Code numbers obtained with such scheme stay valid until the dofs are renumbered,
+     * so they can be cached (see Element :: giveLocationArray).
+     */
+    virtual bool isCacheable() const { return false; }
     /**
      * Returns the equation number for corresponding DOF. The numbering should return nonzero value if
      * the equation is assigned to the given DOF, zero otherwise.
@@ -83,6 +89,7 @@ public:
     EModelDefaultEquationNumbering(void) : UnknownNumberingScheme() { }
 
     virtual bool isDefault() const { return true; }
+    virtual bool isCacheable() const { return true; }
     virtual int giveDofEquationNumber(Dof *dof) const {
         return dof->__giveEquationNumber();
     }
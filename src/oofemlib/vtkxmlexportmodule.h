@@ -51,6 +51,8 @@
 
 #include <string>
 #include <list>
+#include <vector>
+#include <cstdio>
 
 ///@name Input fields for VTK XML export module
 //@{
@@ -62,6 +64,8 @@
 #define _IFT_VTKXMLExportModule_ipvars "ipvars"
 #define _IFT_VTKXMLExportModule_stype "stype"
 #define _IFT_VTKXMLExportModule_particleexportflag "particleexportflag"
+#define _IFT_VTKXMLExportModule_format "format"
+#define _IFT_VTKXMLExportModule_compress "compress"
 //@}
 
 namespace oofem {
@@ -168,6 +172,18 @@ protected:
     /// particle export flag
     bool particleExportFlag;
 
+    /// Encoding of the DataArrays in the exported vtu files.
+    enum VTKDataFormat {
+        VDF_ASCII = 0,      ///< Formatted text (default).
+        VDF_Base64 = 1,     ///< Inline binary data encoded in base64.
+        VDF_AppendedRaw = 2 ///< Raw binary data in the AppendedData section at the end of file.
+    };
+    VTKDataFormat dataFormat;
+    /// Determines whether binary data blocks are compressed by zlib.
+    bool compressFlag;
+    /// Raw binary blocks of the AppendedData section of currently written file.
+    std :: vector< char >appendedData;
+
     /// Buffer for earlier time steps exported to *.pvd file.
     std :: list< std :: string >pvdBuffer;
 
@@ -228,6 +244,30 @@ protected:
 
     /// Returns the output stream for given solution step.
     FILE *giveOutputStream(TimeStep *tStep);
+
+    /// Prints the VTKFile and UnstructuredGrid opening tags, declaring the binary layout when needed.
+    void writeVTKFileHeader(FILE *stream);
+    /// Closes the UnstructuredGrid and VTKFile tags, flushing the appended data section (if any).
+    void writeVTKFileFooter(FILE *stream);
+    /**
+     * Writes a single DataArray element from contiguous buffer, using selected data format.
+     * @param stream Output stream.
+     * @param data Values of the array, tuple by tuple.
+     * @param name Name of the array (NULL if not named, e.g. points).
+     * @param ncomponents Number of components, zero if the attribute should be omitted.
+     */
+    void writeDataArray(FILE *stream, const std :: vector< double > &data, const char *name, int ncomponents);
+    void writeDataArray(FILE *stream, const std :: vector< int > &data, const char *name, int ncomponents = 0);
+    void writeDataArray(FILE *stream, const std :: vector< unsigned char > &data, const char *name, int ncomponents = 0);
+    /// Prints opening tag of DataArray.
+    void writeDataArrayHeader(FILE *stream, const char *type, const char *name, int ncomponents);
+    /// Prints closing tag of DataArray.
+    void writeDataArrayFooter(FILE *stream);
+    /**
+     * Writes binary representation of given data block, preceded by VTK header (with block sizes).
+     * The block is either encoded inline in base64, or stored to appended data.
+     */
+    void writeBinaryData(FILE *stream, const void *data, size_t nbytes);
     /**
      * Returns corresponding element cell_type.
      * Some common element types are supported, others can be supported via interface concept.
@@ -328,14 +368,7 @@ protected:
 
 #ifdef __VTK_MODULE
     void writeVTKPointData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
-#else
-    void writeVTKPointData(FloatArray &valueArray);
-#endif
-
-#ifdef __VTK_MODULE
     void writeVTKCellData(const char *name, vtkSmartPointer< vtkDoubleArray >varArray);
-#else
-    void writeVTKCellData(FloatArray &valueArray);
 #endif
 
     // Export of composite elements (built up from several subcells)
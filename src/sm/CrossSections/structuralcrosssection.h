@@ -109,6 +109,17 @@ public:
      virtual void giveRealStress_AxisymMembrane1d(FloatArray &answer, GaussPoint *gp, const FloatArray &strain, TimeStep *tStep) = 0;
     //@}
 
+    /**
+     * Computes the real stresses of a batch of integration points in 3d stress space.
+     * Strains and stresses are stored as structure of arrays, one row per integration point.
+     * Default implementation evaluates the points one by one by giveRealStress_3d.
+     * @param answer Stresses, one row per integration point.
+     * @param gps Integration points.
+     * @param strains Strains, one row per integration point.
+     * @param tStep Current time step (most models are able to respond only when tStep is current time step).
+     */
+    virtual void giveRealStresses_3dBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
+
     /**
      * Method for computing the stiffness matrix.
      * @param answer Stiffness matrix.
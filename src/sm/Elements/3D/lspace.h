@@ -86,6 +86,7 @@ public:
 
     virtual void HuertaErrorEstimatorI_setupRefinedElementProblem(RefinedElement *refinedElement, int level, int nodeId,
                                                                   IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                                                  DynamicDataReader &refinedReader,
                                                                   HuertaErrorEstimatorInterface :: SetupMode sMode, TimeStep *tStep,
                                                                   int &localNodeId, int &localElemId, int &localBcId,
                                                                   IntArray &controlNode, IntArray &controlDof,
@@ -95,6 +96,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_LSpace_Name; }
     virtual const char *giveClassName() const { return "LSpace"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( LSpace ); }
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void postInitialize();
 #ifdef __OOFEG
@@ -107,6 +109,7 @@ public:
 
 
 protected:
+    virtual void computeBmatrixAt(GaussPoint *gp, FloatMatrix &answer, TimeStep *tStep = NULL, int lowerIndx = 1, int upperIndx = ALL_STRAINS);
     virtual int giveNumberOfIPForMassMtrxIntegration() { return 8; }
 
     /**
@@ -76,6 +76,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_LTRSpace_Name; }
     virtual const char *giveClassName() const { return "LTRSpace"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( LTRSpace ); }
     
 #ifdef __OOFEG
     virtual void drawRawGeometry(oofegGraphicContext &gc, TimeStep *tStep);
@@ -97,6 +98,7 @@ public:
     // HuertaErrorEstimatorInterface
     virtual void HuertaErrorEstimatorI_setupRefinedElementProblem(RefinedElement *refinedElement, int level, int nodeId,
                                                                   IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                                                  DynamicDataReader &refinedReader,
                                                                   HuertaErrorEstimatorInterface :: SetupMode sMode, TimeStep *tStep,
                                                                   int &localNodeId, int &localElemId, int &localBcId,
                                                                   IntArray &controlNode, IntArray &controlDof,
@@ -78,6 +78,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_LWedge_Name; }
     virtual const char *giveClassName() const { return "LWedge"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( LWedge ); }
     
 };
 } // end namespace oofem
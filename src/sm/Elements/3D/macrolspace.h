@@ -68,6 +68,8 @@ public:
     virtual IRResultType initializeFrom(InputRecord *ir);
 
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    /// The stiffness is not of the plain integrated form, the product uses the element matrix.
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep) { Element :: computeTangentTimesVector(answer, v, tStep); }
 
     virtual void computeField(ValueModeType mode, TimeStep *tStep, const FloatArray &lcoords, FloatArray &answer)
     { OOFEM_ERROR("Macro space element doesn't support computing local unknown vector (yet)\n"); }
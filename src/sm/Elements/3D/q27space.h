@@ -75,6 +75,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_Q27Space_Name; }
     virtual const char *giveClassName() const { return "Q27Space"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( Q27Space ); }
 protected:
     virtual int giveNumberOfIPForMassMtrxIntegration() { return 27; }
 
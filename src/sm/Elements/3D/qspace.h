@@ -80,6 +80,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_QSpace_Name; }
     virtual const char *giveClassName() const { return "QSpace"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( QSpace ); }
     
 protected:
 
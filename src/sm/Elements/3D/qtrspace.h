@@ -85,6 +85,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_QTRSpace_Name; }
     virtual const char *giveClassName() const { return "QTRSpace"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( QTRSpace ); }
 
 };
 } // end namespace oofem
@@ -80,6 +80,7 @@ public:
     // definition & identification
     virtual const char *giveInputRecordName() const { return _IFT_QWedge_Name; }
     virtual const char *giveClassName() const { return "QWedge"; }
+    virtual bool allowsInternalForcesInBatch() const { return typeid( * this ) == typeid( QWedge ); }
 
 };
 } // end namespace oofem
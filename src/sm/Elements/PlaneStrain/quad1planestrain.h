@@ -82,6 +82,7 @@ public:
     // HuertaErrorEstimatorInterface
     virtual void HuertaErrorEstimatorI_setupRefinedElementProblem(RefinedElement *refinedElement, int level, int nodeId,
                                                                   IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                                                  DynamicDataReader &refinedReader,
                                                                   HuertaErrorEstimatorInterface :: SetupMode sMode, TimeStep *tStep,
                                                                   int &localNodeId, int &localElemId, int &localBcId,
                                                                   IntArray &controlNode, IntArray &controlDof,
@@ -76,6 +76,8 @@ public:
     virtual void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *, TimeStep *tStep);
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    /// The stiffness is not of the plain integrated form, the product uses the element matrix.
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep) { Element :: computeTangentTimesVector(answer, v, tStep); }
 
     virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
 
@@ -84,6 +84,8 @@ public:
     void computeSurfaceNMatrix (FloatMatrix &answer, int boundaryID, const FloatArray& lcoords);
     
     void computeStiffnessMatrix(FloatMatrix &answer,MatResponseMode rMode, TimeStep *tStep);
+    /// The stiffness is not of the plain integrated form, the product uses the element matrix.
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep) { Element :: computeTangentTimesVector(answer, v, tStep); }
     void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord);
     virtual int giveSpatialDimension(){return 3;}
 protected:
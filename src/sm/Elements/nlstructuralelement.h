@@ -171,6 +171,20 @@ public:
      */
     void computeStiffnessMatrix_withIRulesAsSubcells(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
 
+    /**
+     * Computes the product of the stiffness matrix of receiver with given vector, without forming the matrix.
+     * The products @f$ B^{\mathrm{T}} D B v \;\mathrm{d}v @f$ are summed over the integration points, so that the cost
+     * grows with the number of element unknowns rather than with its square.
+     * Elements with several integration rules, enhanced strains, updated Lagrangian formulation or
+     * additional unknowns fall back to the product with the matrix given by computeStiffnessMatrix.
+     *
+     * @param answer Product of the stiffness matrix and v.
+     * @param v Vector of element unknowns.
+     * @param rMode Response mode.
+     * @param tStep Time step.
+     */
+    void computeStiffnessMatrixTimesVector(FloatArray &answer, const FloatArray &v, MatResponseMode rMode, TimeStep *tStep);
+
     /**
      * Evaluates nodal representation of real internal forces.
      * Necessary transformations are taken into account. @todo what is meant?
@@ -93,6 +93,7 @@ public:
 
     void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType);
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep);
     virtual void computeFirstPKStressVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
     
 protected:
@@ -40,6 +40,9 @@
 #include "fbarelementinterface.h"
 #include "Loads/pressurefollowerloadinterface.h"
 
+#include <vector>
+#include <typeinfo>
+
 
 #define _IFT_Structural3DElement_materialCoordinateSystem "matcs" ///< [optional] Support for material directions based on element orientation.
 
@@ -66,6 +69,11 @@ protected:
 
     bool matRotation;
 
+    /// Flag indicating that internalForcesInBatch are valid for the next call of giveInternalForcesVector.
+    bool internalForcesInBatchValid;
+    /// Internal forces computed from the stresses evaluated in a batch with other elements.
+    FloatArray internalForcesInBatch;
+
 public:
     /**
      * Constructor. Creates element with given number, belonging to given domain.
@@ -95,7 +103,41 @@ public:
     virtual void giveElementParametricCentroid(FloatArray &answer) { answer = {0.0 , 0.0, 0.0};}
     virtual void computeDeformationGradientVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep, ValueModeType modeType);
     virtual void computeStiffnessMatrix(FloatMatrix &answer, MatResponseMode rMode, TimeStep *tStep);
+    virtual void computeTangentTimesVector(FloatArray &answer, const FloatArray &v, TimeStep *tStep);
     virtual void computeFirstPKStressVector(FloatArray &answer, GaussPoint *gp, TimeStep *tStep);
+    virtual void giveInternalForcesVector(FloatArray &answer, TimeStep *tStep, int useUpdatedGpRecord = 0);
+
+    /**
+     * Returns true if the stresses of receiver can be evaluated in a batch together with other elements of the same
+     * material (see StructuralEngngModel::computeInternalForcesInBatches). This is the case for active small strain elements
+     * without local material orientation and enhanced strains, which allow it (see allowsInternalForcesInBatch).
+     * @param tStep Time step.
+     */
+    bool canComputeInternalForcesInBatch(TimeStep *tStep);
+    /**
+     * Returns true if the internal forces of receiver are evaluated by giveInternalForcesVector of this class
+     * from the B matrices given by computeBmatrixAt, so that the stresses may be evaluated in batches.
+     * Element classes opt in for themselves only, derived classes have to opt in explicitly.
+     */
+    virtual bool allowsInternalForcesInBatch() const { return false; }
+    /**
+     * Computes the strains of all integration points of receiver, as a part of a batch.
+     * @param strains Strains of the batch, the strain of i-th point of receiver is stored in row offset + i.
+     * @param b Geometric matrices of the batch, the matrix of i-th point of receiver is stored at index offset + i - 1.
+     * @param offset Number of points of the batch preceding the receiver.
+     * @param tStep Time step.
+     */
+    void computeStrainsInBatch(FloatMatrix &strains, std :: vector< FloatMatrix > &b, int offset, TimeStep *tStep);
+    /**
+     * Computes the internal forces of receiver from the stresses evaluated in a batch.
+     * The forces are returned by the next call of giveInternalForcesVector.
+     * @param stresses Stresses of the batch, stored in the same way as the strains in computeStrainsInBatch.
+     * @param b Geometric matrices of the batch.
+     * @param offset Number of points of the batch preceding the receiver.
+     */
+    void computeInternalForcesInBatch(const FloatMatrix &stresses, const std :: vector< FloatMatrix > &b, int offset);
+    /// Discards the internal forces computed in a batch, if they have not been used.
+    void clearInternalForcesInBatch() { internalForcesInBatchValid = false; }
 
     virtual Interface *giveInterface(InterfaceType it);
 
@@ -40,6 +40,7 @@
 #include "../sm/EngineeringModels/POD/hyperreduction.h"
 #include "../sm/EngineeringModels/POD/podvtkxmlexportmodule.h"
 #include "../sm/EngineeringModels/POD/reduceddomainnumberingscheme.h"
+#include "../sm/EngineeringModels/POD/reducedoperatorassembler.h"
 
 #include "inputrecord.h"
 #include "floatmatrix.h"
@@ -94,6 +95,8 @@
 #define _IFT_POD_computeResultsOutsideRIDFlag "computeresultsoutsiderid"
 #define _IFT_POD_outOfRIDElementSet "outofridelementset"
 
+#define _IFT_POD_precompiledOnline "precompiledonline"
+
 ///@name Input fields for NonLinearStatic
 //@{
 //@}
@@ -130,6 +133,8 @@ protected:
   bool separateBasisFlag;
   /// use different weights for different dofs
   bool dofWeightsFlag;
+  /// evaluate the reduced operators directly from the precompiled elements of the reduced domain
+  bool precompiledOnlineFlag;
 
   /// number of reduced modes taken into account
   int nReducedModes;
@@ -200,6 +205,8 @@ protected:
   std :: vector<IntArray> dofIDMatrix;
   /// set of elements outside RID  where the results will be computed in postprocessing
   IntArray outOfRIDElementSet;
+  /// assembler of reduced operators from the precompiled elements of the reduced domain
+  ReducedOperatorAssembler reducedOperator;
 public:
     POD(int i, EngngModel * _master = NULL);
     virtual ~POD();
@@ -240,6 +247,9 @@ protected:
     void takeSnapshot_dofs(FloatArray &answer, TimeStep *tStep, Domain *d, std:: vector<IntArray> &dofIDMatrix);
     void takeSnapshot_stress(FloatArray &answer, TimeStep *tStep, Domain *d, int &stressSize);
     void buildReducedDomain();
+    void compileReducedOperator(TimeStep *tStep);
+    void assembleReducedStiffnessMatrix(TimeStep *tStep);
+    void assembleReducedInternalForces(TimeStep *tStep, Domain *d);
     void computeExternalLoadReactionContribution(FloatArray &reactions, TimeStep *tStep, int di);
 
     double giveUnknownComponent(ValueModeType mode, TimeStep *tStep, Domain *d, Dof *dof);
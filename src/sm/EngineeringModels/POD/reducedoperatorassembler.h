@@ -0,0 +1,128 @@
+/*
+ *
+ *                 #####    #####   ######  ######  ###   ###
+ *               ##   ##  ##   ##  ##      ##      ## ### ##
+ *              ##   ##  ##   ##  ####    ####    ##  #  ##
+ *             ##   ##  ##   ##  ##      ##      ##     ##
+ *            ##   ##  ##   ##  ##      ##      ##     ##
+ *            #####    #####   ##      ######  ##     ##
+ *
+ *
+ *             OOFEM : Object Oriented Finite Element Code
+ *
+ *               Copyright (C) 1993 - 2013   Borek Patzak
+ *
+ *
+ *
+ *       Czech Technical University, Faculty of Civil Engineering,
+ *   Department of Structural Mechanics, 166 29 Prague, Czech Republic
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef reducedoperatorassembler_h
+#define reducedoperatorassembler_h
+
+#include "intarray.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+#include "valuemodetype.h"
+
+#include <vector>
+
+namespace oofem {
+class Domain;
+class TimeStep;
+class UnknownNumberingScheme;
+class MatrixAssembler;
+class VectorAssembler;
+
+/**
+ * Assembler of the reduced operators in the online stage of the reduced order model.
+ * The elements of the (hyper-)reduced integration domain are compiled once, together with their location arrays and the
+ * rows of the reduced basis belonging to their equations. The reduced stiffness matrix @f$ A^T K A @f$ and the reduced
+ * internal force vector @f$ A^T f @f$ are then summed directly from the element contributions,
+ * without assembling the sparse matrix and vector over the full set of equations.
+ * Rows of the interface dofs (dofs shared with elements outside of the reduced integration domain) are
+ * removed from the test basis, which gives the same operators as zeroing these rows in @f$ K A @f$ and @f$ f @f$.
+ */
+class ReducedOperatorAssembler
+{
+protected:
+    /// Domain of compiled elements.
+    Domain *domain;
+    /// Positions of compiled elements in the domain.
+    IntArray elements;
+    /// Location arrays of compiled elements.
+    std :: vector< IntArray >locations;
+    /// Dof IDs of compiled elements (for the element-by-element norms).
+    std :: vector< IntArray >dofIDs;
+    /// Rows of the reduced basis for equations of each element (trial space).
+    std :: vector< FloatMatrix >trialBases;
+    /// Rows of the reduced basis for equations of each element, with interface dofs removed (test space).
+    std :: vector< FloatMatrix >testBases;
+    /// Equations of all compiled elements.
+    IntArray equations;
+    /// Rows of the reduced basis belonging to equations.
+    FloatMatrix equationBasis;
+    /// Number of reduced modes.
+    int nModes;
+
+public:
+    ReducedOperatorAssembler();
+    ~ReducedOperatorAssembler() { }
+
+    /**
+     * Compiles the elements of given domain.
+     * @param d Domain.
+     * @param s Numbering scheme of the equations, which correspond to the rows of the reduced basis.
+     * @param reducedBasis Reduced basis.
+     * @param interfaceDofs Equations of the interface dofs.
+     * @param tStep Time step, elements inactive in this step are skipped.
+     */
+    void compile(Domain *d, const UnknownNumberingScheme &s, const FloatMatrix &reducedBasis, const IntArray &interfaceDofs, TimeStep *tStep);
+    /// Removes all compiled data.
+    void clear();
+    /// Returns true if the receiver has been compiled.
+    bool isCompiled() const { return nModes > 0; }
+    /// Returns the number of compiled elements.
+    int giveNumberOfElements() const { return elements.giveSize(); }
+
+    /**
+     * Assembles the reduced matrix from the compiled elements.
+     * @param answer Dense reduced matrix.
+     * @param tStep Time step.
+     * @param ma Assembler of element matrices.
+     */
+    void assembleReducedMatrix(FloatMatrix &answer, TimeStep *tStep, const MatrixAssembler &ma);
+    /**
+     * Assembles the reduced vector from the compiled elements.
+     * @param answer Reduced vector.
+     * @param tStep Time step.
+     * @param va Assembler of element vectors.
+     * @param mode Mode of the unknowns.
+     * @param eNorms If non-NULL, the squared norms of the element vectors are summed per dof ID.
+     */
+    void assembleReducedVector(FloatArray &answer, TimeStep *tStep, const VectorAssembler &va, ValueModeType mode, FloatArray *eNorms = NULL);
+    /**
+     * Updates the unknowns of equations of compiled elements from the reduced coordinates.
+     * Other entries of the answer are left untouched.
+     * @param answer Vector of unknowns, sized to the number of equations.
+     * @param reducedCoordinates Reduced coordinates.
+     */
+    void updateUnknowns(FloatArray &answer, const FloatArray &reducedCoordinates) const;
+};
+} // end namespace oofem
+#endif // reducedoperatorassembler_h
@@ -142,6 +142,17 @@ public:
 #endif
 
 protected:
+    /**
+     * Maps internal ip state of all elements of new domain from old domain.
+     * Integration points are collected per material, so that each material maps
+     * all its points in a single pass (see MaterialModelMapperInterface :: MMI_mapPoints).
+     * @param newd Domain which ip state is mapped.
+     * @param oldd Old domain.
+     * @param tStep Time step.
+     * @param skipRemote If true, remote elements are not mapped.
+     * @return Nonzero if o.k.
+     */
+    int mapInternalState(Domain *newd, Domain *oldd, TimeStep *tStep, bool skipRemote);
     void assembleInitialLoadVector(FloatArray &loadVector, FloatArray &loadVectorOfPrescribed,
                                    AdaptiveNonLinearStatic *sourceProblem, int domainIndx, TimeStep *tStep);
     //void assembleCurrentTotalLoadVector (FloatArray& loadVector, FloatArray& loadVectorOfPrescribed,
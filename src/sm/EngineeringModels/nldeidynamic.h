@@ -41,6 +41,8 @@
 #include "sparselinsystemnm.h"
 #include "sparsemtrxtype.h"
 
+#include <vector>
+
 #define LOCAL_ZERO_MASS_REPLACEMENT 1
 
 ///@name Input fields for NlDEIDynamic
@@ -52,6 +54,8 @@
 #define _IFT_NlDEIDynamic_tau "tau"
 #define _IFT_NlDEIDynamic_py "py"
 #define _IFT_NlDEIDynamic_nonlocalext "nonlocalext"
+#define _IFT_NlDEIDynamic_subcycling "subcycling"
+#define _IFT_NlDEIDynamic_maxsublevel "maxsublevel"
 //@}
 
 namespace oofem {
@@ -84,6 +88,13 @@ namespace oofem {
  * - Additional mode has been introduced remote element mode. It introduces the "remote" elements, the
  *   exact local mirrors of remote counterparts. Introduced to support general nonlocal constitutive models,
  *   in order to provide efficient way, how to average local data without need of fine grain communication.
+ *
+ * Subcycling (multi-rate integration, serial only) allows the elements to advance with different time steps.
+ * Elements are binned into levels by their critical time step, elements of level k advance with step deltaT/2^k
+ * (up to maxsublevel). Each equation advances with the step of the finest level of connected elements,
+ * elements are evaluated with the step of their finest equation, using linearly interpolated displacements
+ * of coarser equations. External loads are evaluated once per (whole) step. Thus, a few small elements
+ * do not restrict the time step of the whole model.
  */
 class NlDEIDynamic : public StructuralEngngModel
 {
@@ -98,6 +109,30 @@ protected:
     FloatArray displacementVector, velocityVector, accelerationVector;
     /// Vector of real nodal forces.
     FloatArray internalForces;
+    /// Inverse of effective mass, 1/(m*(1/dt^2 + dumpingCoef/(2*dt))), for each equation.
+    FloatArray effectiveMassInv;
+    /// Coefficients m*(1/dt^2 - dumpingCoef/(2*dt)) multiplying the previous displacement increment.
+    FloatArray previousIncrementCoeff;
+    /// Time step for which effectiveMassInv and previousIncrementCoeff were computed.
+    double coeffDeltaT;
+    /// Critical time step estimate of individual elements.
+    FloatArray elementCriticalTimeStep;
+
+    // subcycling specific vars
+    /// Flag indicating whether subcycling (multi-rate time integration) is used.
+    int subcyclingFlag;
+    /// Maximum subcycling level, the smallest time step is deltaT/2^maxSubLevel.
+    int maxSubLevel;
+    /// Elements and equations of subcycling levels, level k advances with time step deltaT/2^k.
+    std :: vector< IntArray > levelElements, levelEquations;
+    /// Internal forces of elements of individual levels (from their last evaluation).
+    std :: vector< FloatArray > levelInternalForces;
+    /// Time step of individual equations.
+    FloatArray equationTimeStep;
+#ifdef _OPENMP
+    /// Thread local internal force vectors.
+    std :: vector< FloatArray > threadInternalForces;
+#endif
     /// Dumping coefficient (C = dumpingCoef * MassMtrx).
     double dumpingCoef;
     /// Time step.
@@ -157,6 +192,13 @@ public:
 
     virtual int giveNumberOfFirstStep(bool force = false) { return 0; }
 
+    /**
+     * Returns the critical time step estimate of given element, 2/omega, where omega^2 is bounded by the largest
+     * ratio of absolute row sum of stiffness and lumped mass of the element. Available after the mass matrix is assembled.
+     * @param ielem Element number.
+     */
+    double giveElementCriticalTimeStep(int ielem) const { return elementCriticalTimeStep.at(ielem); }
+
 protected:
     /**
      * Assembles the load vector.
@@ -177,6 +219,38 @@ protected:
      */
     void computeMassMtrx(FloatArray &mass, double &maxOm, TimeStep *tStep);
     void computeMassMtrx2(FloatMatrix &mass, double &maxOm, TimeStep *tStep);
+    /**
+     * Assembles the internal force vector.
+     * When compiled with OpenMP, the elements are split into contiguous blocks, each thread
+     * assembles its block into its own vector and the vectors are summed afterwards,
+     * so there is no locking nor element coloring (one synchronization per step).
+     * @param answer Internal force vector.
+     * @param tStep Solution step.
+     */
+    void computeInternalForces(FloatArray &answer, TimeStep *tStep);
+    /**
+     * Assembles the internal forces of given elements (without exchange of shared contributions).
+     * @param answer Internal force vector.
+     * @param tStep Solution step.
+     * @param elements Element numbers, all elements are assembled if NULL.
+     */
+    void assembleInternalForces(FloatArray &answer, TimeStep *tStep, const IntArray *elements);
+    /**
+     * Sorts the elements and equations into subcycling levels according to the critical time steps of elements.
+     * Reduces the time step if the smallest element requires more than maxSubLevel levels.
+     * @param tStep Solution step.
+     */
+    void setUpSubcycling(TimeStep *tStep);
+    /**
+     * Performs the whole time step using subcycling.
+     * @param tStep Solution step.
+     */
+    void solveSubcycledStep(TimeStep *tStep);
+    /**
+     * Computes the coefficients of the central difference scheme derived from
+     * the (lumped) mass matrix for the current time step increment.
+     */
+    void computeMassCoefficients();
 
 public:
     virtual int estimateMaxPackSize(IntArray &commMap, DataStream &buff, int packUnpackType);
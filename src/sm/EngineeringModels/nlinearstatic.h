@@ -37,6 +37,7 @@
 
 #include "../sm/EngineeringModels/linearstatic.h"
 #include "sparsenonlinsystemnm.h"
+#include "timestepcontroller.h"
 
 ///@name Input fields for NonLinearStatic
 //@{
@@ -121,6 +122,10 @@ protected:
     NonLinearStatic_controlType controlMode;
     /// Intrinsic time increment.
     double deltaT;
+    /// Adaptive time step controller; when active, deltaT is only the length of the first step.
+    TimeStepController stepController;
+    /// Number of cuts of the current step.
+    int nStepCuts;
     // print stiffness matrix to a file
     bool printStiffnessFlag;
 
@@ -161,6 +166,8 @@ public:
     virtual TimeStep *giveSolutionStepWhenIcApply(bool force = false);
     virtual TimeStep *giveNextStep();
     virtual NumericalMethod *giveNumericalMethod(MetaStep *mStep);
+    virtual void reduceTimeStep(TimeStep *tStep);
+    virtual bool isTimeSteppingFinished(TimeStep *tStep);
 
     virtual double giveLoadLevel() { return cumulatedLoadLevel + loadLevel; }
 
@@ -38,9 +38,20 @@
 #include "engngm.h"
 #include "statecountertype.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
+
+#include <vector>
+
+///@name Input fields for StructuralEngngModel
+//@{
+#define _IFT_StructuralEngngModel_stressBatch "stressbatch"
+//@}
 
 namespace oofem {
 class StructuralElement;
+class Structural3DElement;
+class StructuralCrossSection;
+class GaussPoint;
 
 /// Assembles the internal forces, without updating the strain.
 ///@todo The need for this is just due to some other design choices. 
@@ -86,6 +97,26 @@ protected:
 
     /// Norm of nodal internal forces evaluated on element by element basis (squared)
     FloatArray internalForcesEBENorm;
+
+    /// Integration points of elements sharing the cross section, whose stresses are evaluated at once.
+    struct StressBatch {
+        StructuralCrossSection *cs;
+        std :: vector< Structural3DElement * >elements;
+        std :: vector< GaussPoint * >gps;
+    };
+    /// Work space for evaluation of one batch (strains, stresses and geometric matrices of all points).
+    struct StressBatchWorkspace {
+        FloatMatrix strains, stresses;
+        std :: vector< FloatMatrix >b;
+    };
+    /// Flag indicating that the stresses are evaluated in batches (see computeInternalForcesInBatches).
+    bool stressBatching;
+    /// Batches of last evaluation, kept to reuse the allocated storage.
+    std :: vector< StressBatch >stressBatches;
+    /// Number of batches in use.
+    int nStressBatches;
+    /// Work spaces of individual threads.
+    std :: vector< StressBatchWorkspace >stressBatchWorkspaces;
     /**
      * Computes and prints reaction forces, computed from nodal internal forces. Assumes, that real
      * stresses corresponding to reached state are already computed (uses giveInternalForcesVector
@@ -114,6 +145,25 @@ protected:
      * @param tStep Solution step.
      */
     virtual void giveInternalForces(FloatArray &answer, bool normFlag, int di, TimeStep *tStep);
+    /**
+     * Lets the materials of given domain solve the subscale problems of all their integration points
+     * before the internal forces are assembled (see Material::solveSubscaleProblems).
+     * @param d Domain.
+     * @param tStep Solution step.
+     */
+    void solveSubscaleProblems(Domain *d, TimeStep *tStep);
+    /**
+     * Evaluates the stresses of small strain 3d elements before the internal forces are assembled. The integration points
+     * of elements sharing the cross section are collected into batches of limited size, so that the material evaluates
+     * many points in one call (see StructuralCrossSection::giveRealStresses_3dBatch), and the batches are spread over
+     * the available threads. The element internal forces computed from the stresses are kept by elements until
+     * they are assembled; releaseInternalForceBatches must be called after the assembly.
+     * @param d Domain.
+     * @param tStep Solution step.
+     */
+    void computeInternalForcesInBatches(Domain *d, TimeStep *tStep);
+    /// Discards the element internal forces computed by computeInternalForcesInBatches, which have not been assembled.
+    void releaseInternalForceBatches();
 
     /**
      * Updates nodal values
@@ -130,6 +180,7 @@ public:
     /// Destructor.
     virtual ~StructuralEngngModel();
 
+    virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void updateYourself(TimeStep *tStep);
 
     virtual int checkConsistency();
@@ -76,6 +76,7 @@
 namespace oofem {
 class Element;
 class GaussPoint;
+class DynamicDataReader;
 
 /**
  * The implementation of Zienkiewicz Zhu Error Estimator.
@@ -90,6 +91,10 @@ class GaussPoint;
  * using interface concept.
  * This estimator also provides the compatible Remeshing Criteria, which
  * based on error measure will evaluate the required mesh density of a new domain.
+ *
+ * In linear analysis, the refined patch and element problems are independent of each other
+ * and are solved concurrently, each one built from its own input reader. Their results are
+ * combined in the order of nodes and elements, so the estimate does not depend on the number of threads.
  */
 class HuertaErrorEstimator : public ErrorEstimator
 {
@@ -181,22 +186,30 @@ private:
 
     /**
      * Solves the refined element problem.
+     * The element error norm is stored in eNorms, the contributions to the global norms are returned,
+     * so that the element problems can be solved in any order.
      * @param elemId Element id.
      * @param localNodeIdArray Array of local problem node ids.
      * @param globalNodeIdArray Array of global problem node ids.
      * @param tStep Time step.
+     * @param eNorm2 Contribution of the element to the squared global error norm.
+     * @param uNorm2 Contribution of the element to the squared global norm of primary unknown.
+     * @return False if the element is skipped (remote or in skipped region), true otherwise.
      */
-    void solveRefinedElementProblem(int elemId, IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
-                                    TimeStep *tStep);
+    bool solveRefinedElementProblem(int elemId, IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                    TimeStep *tStep, double &eNorm2, double &uNorm2);
     /**
      * Solves the refined patch problem.
+     * The fine solution is returned instead of being stored in primaryUnknownError,
+     * so that the patch problems can be solved in any order.
      * @param nodeId Node id.
      * @param localNodeIdArray Array of local problem node ids.
-     * @param globalNodeIdArray Array of global problem node ids.
+     * @param globalNodeIdArray Array of global problem node ids; empty if the patch is skipped.
+     * @param patchSolution Fine solution at the patch nodes, ordered as globalNodeIdArray.
      * @param tStep Time step.
      */
     void solveRefinedPatchProblem(int nodeId, IntArray &localNodeIdArray,
-                                  IntArray &globalNodeIdArray, TimeStep *tStep);
+                                  IntArray &globalNodeIdArray, FloatArray &patchSolution, TimeStep *tStep);
     /**
      * Solves the refined whole problem.
      * @param localNodeIdArray Array of local problem node ids.
@@ -214,11 +227,11 @@ private:
      */
     void extractVectorFrom(Element *element, FloatArray &vector, FloatArray &answer, int dofs, TimeStep *tStep);
 
-    void setupRefinedProblemProlog(const char *problemName, int problemId, IntArray &localNodeIdArray,
-                                   int nodes, int elems, int csects, int mats, int loads, int funcs,
+    void setupRefinedProblemProlog(DynamicDataReader &refinedReader, const char *problemName, int problemId,
+                                   IntArray &localNodeIdArray, int nodes, int elems, int csects, int mats, int loads, int funcs,
                                    IntArray &controlNode, IntArray &controlDof, TimeStep *tStep);
-    void setupRefinedProblemEpilog1(int csects, int mats, int loads, int nlbarriers);
-    void setupRefinedProblemEpilog2(int tfuncs);
+    void setupRefinedProblemEpilog1(DynamicDataReader &refinedReader, int csects, int mats, int loads, int nlbarriers);
+    void setupRefinedProblemEpilog2(DynamicDataReader &refinedReader, int tfuncs);
 };
 
 
@@ -238,6 +251,7 @@ public:
 
     virtual void HuertaErrorEstimatorI_setupRefinedElementProblem(RefinedElement *refinedElement, int level, int nodeId,
                                                                   IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                                                  DynamicDataReader &refinedReader,
                                                                   HuertaErrorEstimatorInterface :: SetupMode mode, TimeStep *tStep,
                                                                   int &localNodeId, int &localElemId, int &localBcId,
                                                                   IntArray &controlNode, IntArray &controlDof,
@@ -248,6 +262,7 @@ public:
 protected:
     void setupRefinedElementProblem1D(Element *element, RefinedElement *refinedElement,
                                       int level, int nodeId, IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                      DynamicDataReader &refinedReader,
                                       HuertaErrorEstimatorInterface :: SetupMode mode, TimeStep *tStep, int nodes,
                                       FloatArray **corner, FloatArray &midNode,
                                       int &localNodeId, int &localElemId, int &localBcId,
@@ -256,6 +271,7 @@ protected:
 
     void setupRefinedElementProblem2D(Element *element, RefinedElement *refinedElement,
                                       int level, int nodeId, IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                      DynamicDataReader &refinedReader,
                                       HuertaErrorEstimatorInterface :: SetupMode mode, TimeStep *tStep, int nodes,
                                       FloatArray **corner, FloatArray *midSide, FloatArray &midNode,
                                       int &localNodeId, int &localElemId, int &localBcId,
@@ -264,6 +280,7 @@ protected:
 
     void setupRefinedElementProblem3D(Element *element, RefinedElement *refinedElement,
                                       int level, int nodeId, IntArray &localNodeIdArray, IntArray &globalNodeIdArray,
+                                      DynamicDataReader &refinedReader,
                                       HuertaErrorEstimatorInterface :: SetupMode mode, TimeStep *tStep, int nodes,
                                       FloatArray **corner, FloatArray *midSide, FloatArray *midFace, FloatArray &midNode,
                                       int &localNodeId, int &localElemId, int &localBcId,
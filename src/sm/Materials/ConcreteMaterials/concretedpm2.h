@@ -41,6 +41,7 @@
 #include "cltypes.h"
 #include "../sm/Materials/structuralms.h"
 #include "Materials/isolinearelasticmaterial.h"
+#include "materialstatestore.h"
 #include "gausspoint.h"
 #include "mathfem.h"
 
@@ -94,88 +95,60 @@ public:
         ConcreteDPM2_VertexCompressionDamage,
         ConcreteDPM2_VertexTensionDamage
     };
+    /// Layout of the history record of the receiver.
+    enum CDPM2_HistoryVariable {
+        /// Plastic strain (6 components).
+        CDPM2_PlasticStrain,
+        /// Hardening variable of the plasticity model.
+        CDPM2_KappaP = CDPM2_PlasticStrain + 6,
+        CDPM2_Alpha,
+        CDPM2_EquivStrain,
+        CDPM2_EquivStrainTension,
+        CDPM2_EquivStrainCompression,
+        CDPM2_KappaDTension,
+        CDPM2_KappaDCompression,
+        CDPM2_KappaDTensionOne,
+        CDPM2_KappaDCompressionOne,
+        CDPM2_KappaDTensionTwo,
+        CDPM2_KappaDCompressionTwo,
+        CDPM2_DamageTension,
+        CDPM2_DamageCompression,
+        CDPM2_RateFactor,
+        /// Strain used for calculation of strain rates.
+        CDPM2_RateStrain,
+        /// State (i.e. elastic, unloading, plastic, damage, vertex) of the Gauss point.
+        CDPM2_StateFlag,
+#ifdef keep_track_of_dissipated_energy
+        /// Density of total work done by stresses on strain increments.
+        CDPM2_StressWork,
+        /// Density of dissipated work.
+        CDPM2_DissWork,
+#endif
+        CDPM2_RecordSize
+    };
+
 protected:
-    /// @name History variables of the plasticity model
-    //@{
-    FloatArray plasticStrain;
-    FloatArray tempPlasticStrain;
+    /// History variables (converged and non-equilibrated), see CDPM2_HistoryVariable.
+    InlineMaterialStateRecord< CDPM2_RecordSize >history;
 
     double dFDKappa;
     double deltaLambda;
-    //@}
-
-    /// @name Hardening variable
-    //@{
-    double kappaP;
-    double tempKappaP;
-    //@}
 
     double kappaPPeak;
 
     double le;
 
-    double alpha;
-    double tempAlpha;
-
-    double equivStrain;
-    double tempEquivStrain;
-
-    double equivStrainTension;
-    double tempEquivStrainTension;
-
-    double equivStrainCompression;
-    double tempEquivStrainCompression;
-
-    double kappaDTension;
-    double tempKappaDTension;
-
-    double kappaDCompression;
-    double tempKappaDCompression;
-
-    double kappaDTensionOne;
-    double tempKappaDTensionOne;
-
-    double kappaDCompressionOne;
-    double tempKappaDCompressionOne;
-
-    double kappaDTensionTwo;
-    double tempKappaDTensionTwo;
-
-    double kappaDCompressionTwo;
-    double tempKappaDCompressionTwo;
-
-    double damageTension;
-    double tempDamageTension;
-
-    double damageCompression;
-    double tempDamageCompression;
-
     double deltaEquivStrain;
 
-    double rateFactor;
-    double tempRateFactor;
-
-    /// Strains that are used for calculation of strain rates
-    double rateStrain;
-    double tempRateStrain;
-
-    /// Indicates the state (i.e. elastic, unloading, plastic, damage, vertex) of the Gauss point
-    int state_flag;
-    int temp_state_flag;
-#ifdef keep_track_of_dissipated_energy
-    /// Density of total work done by stresses on strain increments.
-    double stressWork;
-    /// Non-equilibrated density of total work done by stresses on strain increments.
-    double tempStressWork;
-    /// Density of dissipated work.
-    double dissWork;
-    /// Non-equilibrated density of dissipated work.
-    double tempDissWork;
-#endif
-
 public:
-    /// Constructor
-    ConcreteDPM2Status(int n, Domain *d, GaussPoint *gp);
+    /**
+     * Constructor.
+     * @param n Status number.
+     * @param d Domain.
+     * @param gp Integration point.
+     * @param store Store of history variables, if NULL the variables are allocated individually.
+     */
+    ConcreteDPM2Status(int n, Domain *d, GaussPoint *gp, std :: shared_ptr< MaterialStateStore >store = nullptr);
 
     /// Destructor
     virtual ~ConcreteDPM2Status();
@@ -191,9 +164,10 @@ public:
 
     /**
      * Get the plastic strain deviator from the material status.
-     * @return Plastic strain deviator.
+     * @param answer Plastic strain deviator.
      */
-    const FloatArray &givePlasticStrain() const { return plasticStrain; }
+    void givePlasticStrain(FloatArray &answer) const
+    { history.giveVector(answer, CDPM2_PlasticStrain, 6); }
 
 
     /**
@@ -202,7 +176,8 @@ public:
      */
     double giveDeviatoricPlasticStrainNorm()
     {
-        FloatArray dev;
+        FloatArray plasticStrain, dev;
+        this->givePlasticStrain(plasticStrain);
         StructuralMaterial :: computeDeviatoricVolumetricSplit(dev, plasticStrain);
         return sqrt( .5 * ( 2. * dev [ 0 ] * dev [ 0 ] + 2. * dev [ 1 ] * dev [ 1 ] + 2. * dev [ 2 ] * dev [ 2 ] +
                     dev [ 3 ] * dev [ 3 ] + dev [ 4 ] * dev [ 4 ] + dev [ 5 ] * dev [ 5 ] ) );
@@ -214,7 +189,7 @@ public:
      */
     double giveVolumetricPlasticStrain() const
     {
-        return 1. / 3. * ( plasticStrain(0) + plasticStrain(1) + plasticStrain(2) );
+        return 1. / 3. * ( history.give(CDPM2_PlasticStrain) + history.give(CDPM2_PlasticStrain + 1) + history.give(CDPM2_PlasticStrain + 2) );
     }
 
     /**
@@ -222,7 +197,7 @@ public:
      * @return The hardening variable of the plasticity model.
      */
     double giveKappaP() const
-    { return kappaP; }
+    { return history.give(CDPM2_KappaP); }
 
     /**
      * Get the hardening variable of the damage model from the
@@ -230,7 +205,7 @@ public:
      * @return Hardening variable kappaD.
      */
     double giveKappaDTensionOne() const
-    { return kappaDTensionOne; }
+    { return history.give(CDPM2_KappaDTensionOne); }
 
     /**
      * Get the compression hardening variable one of the damage model from the
@@ -238,7 +213,7 @@ public:
      * @return Hardening variable kappaDCompressionOne.
      */
     double giveKappaDCompressionOne() const
-    { return kappaDCompressionOne; }
+    { return history.give(CDPM2_KappaDCompressionOne); }
 
 
     /**
@@ -247,7 +222,7 @@ public:
      * @return Hardening variable kappaDTensionTwo.
      */
     double giveKappaDTensionTwo() const
-    { return kappaDTensionTwo; }
+    { return history.give(CDPM2_KappaDTensionTwo); }
 
 
     /**
@@ -256,7 +231,7 @@ public:
      * @return Hardening variable kappaDCompressionTwo.
      */
     double giveKappaDCompressionTwo() const
-    { return kappaDCompressionTwo; }
+    { return history.give(CDPM2_KappaDCompressionTwo); }
 
 
     /**
@@ -265,7 +240,7 @@ public:
      * @return Equivalent strain equivStrain.
      */
     double giveEquivStrain() const
-    { return equivStrain; }
+    { return history.give(CDPM2_EquivStrain); }
 
     /**
      * Get the tension equivalent strain from the
@@ -273,7 +248,7 @@ public:
      * @return Equivalent strain equivStrainTension.
      */
     double giveEquivStrainTension() const
-    { return equivStrainTension; }
+    { return history.give(CDPM2_EquivStrainTension); }
 
 
     /**
@@ -282,7 +257,7 @@ public:
      * @return Equivalent strain equivStrainCompression.
      */
     double giveEquivStrainCompression() const
-    { return equivStrainCompression; }
+    { return history.give(CDPM2_EquivStrainCompression); }
 
     /**
      * Get the tension damage variable of the damage model from the
@@ -290,7 +265,7 @@ public:
      * @return Tension damage variable damageTension.
      */
     double giveDamageTension() const
-    { return damageTension; }
+    { return history.give(CDPM2_DamageTension); }
 
 
     /**
@@ -299,7 +274,7 @@ public:
      * @return Compressive damage variable damageCompression.
      */
     double giveDamageCompression() const
-    { return damageCompression; }
+    { return history.give(CDPM2_DamageCompression); }
 
 
 
@@ -309,7 +284,7 @@ public:
      * @return rate factor rateFactor.
      */
     double giveRateFactor() const
-    { return rateFactor; }
+    { return history.give(CDPM2_RateFactor); }
 
     /**
      * Get the temp variable of the damage model from the
@@ -317,24 +292,24 @@ public:
      * @return Damage variable damage.
      */
     double giveTempRateFactor() const
-    { return tempRateFactor; }
+    { return history.giveTemp(CDPM2_RateFactor); }
 
 
     double giveRateStrain() const
-    { return rateStrain; }
+    { return history.give(CDPM2_RateStrain); }
 
     void letTempRateStrainBe(double v)
-    { tempRateStrain = v; }
+    { history.setTemp(CDPM2_RateStrain, v); }
 
     void letTempAlphaBe(double v)
-    { tempAlpha = v; }
+    { history.setTemp(CDPM2_Alpha, v); }
 
     /**
      * Get the state flag from the material status.
      * @return State flag (i.e. elastic, unloading, yielding, vertex case yielding)
      */
     int giveStateFlag() const
-    { return state_flag; }
+    { return ( int ) history.give(CDPM2_StateFlag); }
 
 
     // giveTemp:
@@ -342,15 +317,16 @@ public:
     // Functions used to access the temp variables.
     /**
      * Get the temp value of the full plastic strain vector from the material status.
-     * @return Temp value of plastic strain vector.
+     * @param answer Temp value of plastic strain vector.
      */
-    const FloatArray &giveTempPlasticStrain() const { return tempPlasticStrain; }
+    void giveTempPlasticStrain(FloatArray &answer) const
+    { history.giveTempVector(answer, CDPM2_PlasticStrain, 6); }
 
     /**
      *  Get the temp value of the volumetric plastic strain in plane stress
      */
     double giveTempVolumetricPlasticStrain() const
-    { return 1. / 3. * ( tempPlasticStrain(0) + tempPlasticStrain(1) + tempPlasticStrain(2) ); }
+    { return 1. / 3. * ( history.giveTemp(CDPM2_PlasticStrain) + history.giveTemp(CDPM2_PlasticStrain + 1) + history.giveTemp(CDPM2_PlasticStrain + 2) ); }
 
 
     /**
@@ -359,7 +335,7 @@ public:
      * @return Temp value of hardening variable kappaP.
      */
     double giveTempKappaP() const
-    { return tempKappaP; }
+    { return history.giveTemp(CDPM2_KappaP); }
 
 
     /**
@@ -368,10 +344,10 @@ public:
      * @return Temp value of the damage variable damage.
      */
     double giveKappaDTension() const
-    { return kappaDTension; }
+    { return history.give(CDPM2_KappaDTension); }
 
     double giveAlpha() const
-    { return alpha; }
+    { return history.give(CDPM2_Alpha); }
 
 
     /**
@@ -380,7 +356,7 @@ public:
      * @return Temp value of the damage variable damage.
      */
     double giveKappaDCompression() const
-    { return kappaDCompression; }
+    { return history.give(CDPM2_KappaDCompression); }
 
 
     /**
@@ -389,7 +365,7 @@ public:
      * @return Temp value of the damage variable damage.
      */
     double giveTempDamageTension() const
-    { return tempDamageTension; }
+    { return history.giveTemp(CDPM2_DamageTension); }
 
 
     /**
@@ -398,7 +374,7 @@ public:
      * @return Temp value of the damage variable damage.
      */
     double giveTempDamageCompression() const
-    { return tempDamageCompression; }
+    { return history.giveTemp(CDPM2_DamageCompression); }
 
     /**
      * Get the temp value of the hardening variable of the damage model
@@ -415,7 +391,7 @@ public:
      * yielding, vertex case yielding).
      */
     int giveTempStateFlag() const
-    { return temp_state_flag; }
+    { return ( int ) history.giveTemp(CDPM2_StateFlag); }
 
 
     // letTemp...be :
@@ -425,7 +401,7 @@ public:
      * @param v New temp value of deviatoric plastic strain
      */
     void letTempPlasticStrainBe(const FloatArray &v)
-    { tempPlasticStrain = v; }
+    { history.setTempVector(CDPM2_PlasticStrain, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
@@ -439,91 +415,91 @@ public:
      * @param v New temp value of the hardening variable
      */
     void letTempKappaPBe(double v)
-    { tempKappaP = v; }
+    { history.setTemp(CDPM2_KappaP, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempKappaDTensionBe(double v)
-    { tempKappaDTension = v; }
+    { history.setTemp(CDPM2_KappaDTension, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempKappaDCompressionBe(double v)
-    { tempKappaDCompression = v; }
+    { history.setTemp(CDPM2_KappaDCompression, v); }
 
     /**
      * Assign the temp value of the hardening variable of the damage model.
      * @param v New temp value of the hardening variable
      */
     void letTempKappaDTensionOneBe(double v)
-    { tempKappaDTensionOne = v; }
+    { history.setTemp(CDPM2_KappaDTensionOne, v); }
 
     /**
      * Assign the temp value of the hardening variable of the damage model.
      * @param v New temp value of the hardening variable
      */
     void letTempKappaDCompressionOneBe(double v)
-    { tempKappaDCompressionOne = v; }
+    { history.setTemp(CDPM2_KappaDCompressionOne, v); }
 
     /**
      * Assign the temp value of the second tension hardening variable of the damage model.
      * @param v New temp value of the second tension hardening variable
      */
     void letTempKappaDTensionTwoBe(double v)
-    { tempKappaDTensionTwo = v; }
+    { history.setTemp(CDPM2_KappaDTensionTwo, v); }
 
     /**
      * Assign the temp value of the second compression hardening variable of the damage model.
      * @param v New temp value of the second compression hardening variable
      */
     void letTempKappaDCompressionTwoBe(double v)
-    { tempKappaDCompressionTwo = v; }
+    { history.setTemp(CDPM2_KappaDCompressionTwo, v); }
 
     /**
      * Assign the temp value of the tensile damage variable of the damage model.
      * @param v New temp value of the tensile damage variable
      */
     void letTempDamageTensionBe(double v)
-    { tempDamageTension = v; }
+    { history.setTemp(CDPM2_DamageTension, v); }
 
     /**
      * Assign the temp value of the compressive damage variable of the damage model.
      * @param v New temp value of the compressive damage variable
      */
     void letTempDamageCompressionBe(double v)
-    { tempDamageCompression = v; }
+    { history.setTemp(CDPM2_DamageCompression, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempRateFactorBe(double v)
-    { tempRateFactor = v; }
+    { history.setTemp(CDPM2_RateFactor, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempEquivStrainBe(double v)
-    { tempEquivStrain = v; }
+    { history.setTemp(CDPM2_EquivStrain, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempEquivStrainTensionBe(double v)
-    { tempEquivStrainTension = v; }
+    { history.setTemp(CDPM2_EquivStrainTension, v); }
 
     /**
      * Assign the temp value of the rate factor of the damage model.
      * @param v New temp value of the damage variable
      */
     void letTempEquivStrainCompressionBe(double v)
-    { tempEquivStrainCompression = v; }
+    { history.setTemp(CDPM2_EquivStrainCompression, v); }
 
 
     /**
@@ -543,24 +519,24 @@ public:
      * vertex case yielding).
      */
     void letTempStateFlagBe(const int v)
-    { temp_state_flag = v; }
+    { history.setTemp(CDPM2_StateFlag, v); }
 
 
     void letKappaPPeakBe(double kappa)
     { kappaPPeak = kappa; }
 #ifdef keep_track_of_dissipated_energy
     /// Returns the density of total work of stress on strain increments.
-    double giveStressWork() { return stressWork; }
+    double giveStressWork() { return history.give(CDPM2_StressWork); }
     /// Returns the temp density of total work of stress on strain increments.
-    double giveTempStressWork() { return tempStressWork; }
+    double giveTempStressWork() { return history.giveTemp(CDPM2_StressWork); }
     /// Sets the density of total work of stress on strain increments to given value.
-    void setTempStressWork(double w) { tempStressWork = w; }
+    void setTempStressWork(double w) { history.setTemp(CDPM2_StressWork, w); }
     /// Returns the density of dissipated work.
-    double giveDissWork() { return dissWork; }
+    double giveDissWork() { return history.give(CDPM2_DissWork); }
     /// Returns the density of temp dissipated work.
-    double giveTempDissWork() { return tempDissWork; }
+    double giveTempDissWork() { return history.giveTemp(CDPM2_DissWork); }
     /// Sets the density of dissipated work to given value.
-    void setTempDissWork(double w) { tempDissWork = w; }
+    void setTempDissWork(double w) { history.setTemp(CDPM2_DissWork, w); }
     /**
      * Computes the increment of total stress work and of dissipated work
      * (gf is the dissipation density per unit volume at complete failure,
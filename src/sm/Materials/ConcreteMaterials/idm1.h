@@ -118,7 +118,7 @@ class IsotropicDamageMaterial1Status : public IsotropicDamageMaterialStatus, pub
 {
 public:
     /// Constructor
-    IsotropicDamageMaterial1Status(int n, Domain *d, GaussPoint *g);
+    IsotropicDamageMaterial1Status(int n, Domain *d, GaussPoint *g, std :: shared_ptr< MaterialStateStore >store = nullptr);
     /// Destructor
     virtual ~IsotropicDamageMaterial1Status() { }
 
@@ -260,6 +260,8 @@ public:
     // identification and auxiliary functions
     virtual const char *giveClassName() const { return "IsotropicDamageMaterial1"; }
     virtual const char *giveInputRecordName() const { return _IFT_IsotropicDamageMaterial1_Name; }
+    /// The damage is evaluated by computeEquivalentStrain and computeDamageParam, as in the batch kernel of IsotropicDamageMaterial.
+    virtual bool hasStressBatchKernel() const { return typeid( * this ) == typeid( IsotropicDamageMaterial1 ); }
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
     /**
@@ -336,6 +338,7 @@ public:
     virtual Interface *giveInterface(InterfaceType it);
 
     virtual int MMI_map(GaussPoint *gp, Domain *oldd, TimeStep *tStep);
+    virtual int MMI_mapPoints(const std :: vector< GaussPoint * > &gps, Domain *oldd, TimeStep *tStep);
     virtual int MMI_update(GaussPoint *gp, TimeStep *tStep, FloatArray *estrain = NULL);
     virtual int MMI_finish(TimeStep *tStep);
 
@@ -41,6 +41,7 @@
 #define keep_track_of_dissipated_energy
 
 #include "material.h"
+#include "materialstatestore.h"
 #include "Materials/linearelasticmaterial.h"
 #include "../sm/Materials/structuralmaterial.h"
 #include "../sm/Materials/structuralms.h"
@@ -62,15 +63,25 @@ class GaussPoint;
  */
 class IsotropicDamageMaterialStatus : public StructuralMaterialStatus
 {
+public:
+    /// Layout of the history record of the receiver.
+    enum IDM_HistoryVariable {
+        /// Scalar measure of the largest strain level ever reached in material.
+        IDM_Kappa,
+        /// Damage level of material.
+        IDM_Damage,
+#ifdef keep_track_of_dissipated_energy
+        /// Density of total work done by stresses on strain increments.
+        IDM_StressWork,
+        /// Density of dissipated work.
+        IDM_DissWork,
+#endif
+        IDM_RecordSize
+    };
+
 protected:
-    /// Scalar measure of the largest strain level ever reached in material.
-    double kappa;
-    /// Non-equilibrated scalar measure of the largest strain level.
-    double tempKappa;
-    /// Damage level of material.
-    double damage;
-    /// Non-equilibrated damage level of material.
-    double tempDamage;
+    /// History variables (converged and non-equilibrated), see IDM_HistoryVariable.
+    InlineMaterialStateRecord< IDM_RecordSize >history;
     ///
     FloatArray castingStrain;
 
@@ -86,37 +97,32 @@ protected:
     /// Crack orientation normalized to damage magnitude. This is useful for plotting cracks as a vector field (paraview etc.).
     FloatArray crackVector;
 
-#ifdef keep_track_of_dissipated_energy
-    /// Density of total work done by stresses on strain increments.
-    double stressWork;
-    /// Non-equilibrated density of total work done by stresses on strain increments.
-    double tempStressWork;
-    /// Density of dissipated work.
-    double dissWork;
-    /// Non-equilibrated density of dissipated work.
-    double tempDissWork;
-#endif
-
 public:
-    /// Constructor
-    IsotropicDamageMaterialStatus(int n, Domain *d, GaussPoint *g);
+    /**
+     * Constructor.
+     * @param n Status number.
+     * @param d Domain.
+     * @param g Integration point.
+     * @param store Store of history variables, if NULL the variables are allocated individually.
+     */
+    IsotropicDamageMaterialStatus(int n, Domain *d, GaussPoint *g, std :: shared_ptr< MaterialStateStore >store = nullptr);
     /// Destructor
     virtual ~IsotropicDamageMaterialStatus();
 
     virtual void printOutputAt(FILE *file, TimeStep *tStep);
 
     /// Returns the last equilibrated scalar measure of the largest strain level.
-    double giveKappa() { return kappa; }
+    double giveKappa() { return history.give(IDM_Kappa); }
     /// Returns the temp. scalar measure of the largest strain level.
-    double giveTempKappa() { return tempKappa; }
+    double giveTempKappa() { return history.giveTemp(IDM_Kappa); }
     /// Sets the temp scalar measure of the largest strain level to given value.
-    void setTempKappa(double newKappa) { tempKappa = newKappa; }
+    void setTempKappa(double newKappa) { history.setTemp(IDM_Kappa, newKappa); }
     /// Returns the last equilibrated damage level.
-    double giveDamage() { return damage; }
+    double giveDamage() { return history.give(IDM_Damage); }
     /// Returns the temp. damage level.
-    double giveTempDamage() { return tempDamage; }
+    double giveTempDamage() { return history.giveTemp(IDM_Damage); }
     /// Sets the temp damage level to given value.
-    void setTempDamage(double newDamage) { tempDamage = newDamage; }
+    void setTempDamage(double newDamage) { history.setTemp(IDM_Damage, newDamage); }
 
     /// Returns characteristic length stored in receiver.
     double giveLe() { return le; }
@@ -138,17 +144,17 @@ public:
     
 #ifdef keep_track_of_dissipated_energy
     /// Returns the density of total work of stress on strain increments.
-    double giveStressWork() { return stressWork; }
+    double giveStressWork() { return history.give(IDM_StressWork); }
     /// Returns the temp density of total work of stress on strain increments.
-    double giveTempStressWork() { return tempStressWork; }
+    double giveTempStressWork() { return history.giveTemp(IDM_StressWork); }
     /// Sets the density of total work of stress on strain increments to given value.
-    void setTempStressWork(double w) { tempStressWork = w; }
+    void setTempStressWork(double w) { history.setTemp(IDM_StressWork, w); }
     /// Returns the density of dissipated work.
-    double giveDissWork() { return dissWork; }
+    double giveDissWork() { return history.give(IDM_DissWork); }
     /// Returns the density of temp dissipated work.
-    double giveTempDissWork() { return tempDissWork; }
+    double giveTempDissWork() { return history.giveTemp(IDM_DissWork); }
     /// Sets the density of dissipated work to given value.
-    void setTempDissWork(double w) { tempDissWork = w; }
+    void setTempDissWork(double w) { history.setTemp(IDM_DissWork, w); }
     /// Computes the increment of total stress work and of dissipated work.
     void computeWork(GaussPoint *gp);
 #endif
@@ -218,6 +224,7 @@ public:
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep)
     { this->giveRealStressVector(answer, gp, reducedE, tStep); }
+    virtual void giveRealStressVector_3dBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep)
     { this->giveRealStressVector(answer, gp, reducedE, tStep); }
     virtual void giveRealStressVector_StressControl(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, const IntArray &strainControl, TimeStep *tStep)
@@ -268,9 +275,19 @@ public:
     virtual IRResultType initializeFrom(InputRecord *ir);
     virtual void giveInputRecord(DynamicInputRecord &input);
 
-    MaterialStatus *CreateStatus(GaussPoint *gp) const { return new IsotropicDamageMaterialStatus(1, domain, gp); }
+    MaterialStatus *CreateStatus(GaussPoint *gp) const
+    { return new IsotropicDamageMaterialStatus( 1, domain, gp, this->giveStateStore(IsotropicDamageMaterialStatus :: IDM_RecordSize) ); }
 
 protected:
+    /**
+     * Evaluates the temporary equivalent strain and damage according to the loading/unloading criterion.
+     * @param[out] tempKappa Temporary value of the damage-driving variable.
+     * @param[out] omega Temporary damage.
+     * @param strain Stress dependent part of the strain vector.
+     * @param gp Integration point.
+     * @param tStep Time step.
+     */
+    void computeTempKappaAndDamage(double &tempKappa, double &omega, FloatArray &strain, GaussPoint *gp, TimeStep *tStep);
     /**
      * Abstract service allowing to perform some initialization, when damage first appear.
      * @param kappa Scalar measure of strain level.
@@ -39,6 +39,7 @@
 #include "dictionary.h"
 #include "floatarray.h"
 #include "floatmatrix.h"
+#include "floatmatrixf.h"
 
 #include "MixedPressure/mixedpressurematerialextensioninterface.h"
 
@@ -77,6 +78,10 @@ protected:
     double nu;
     /// Shear modulus.
     double G;
+    /// Precomputed 3d stiffness matrix.
+    FloatMatrixF< 6, 6 >tangent;
+    /// Precomputed plane stress stiffness matrix.
+    FloatMatrixF< 3, 3 >tangentPlaneStress;
 
 public:
     /**
@@ -141,6 +146,15 @@ public:
                                           MatResponseMode, GaussPoint *gp,
                                           TimeStep *tStep);
 
+    virtual FloatMatrixF< 6, 6 >give3dMaterialStiffnessMatrixF(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep) { return tangent; }
+    virtual void giveRealStressVector_3dBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
+    virtual bool hasStressBatchKernel() const { return typeid( * this ) == typeid( IsotropicLinearElasticMaterial ); }
+    virtual FloatMatrixF< 3, 3 >givePlaneStressStiffMtrxF(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep)
+    {
+        this->giveStatus(gp);
+        return tangentPlaneStress;
+    }
+
     virtual void givePlaneStrainStiffMtrx(FloatMatrix &answer,
                                           MatResponseMode, GaussPoint *gp,
                                           TimeStep *tStep);
@@ -192,6 +206,9 @@ public:
 
     virtual void giveInverseOfBulkModulus(double &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep){ answer  = 3. * ( 1. - 2. * nu ) / E; }
 
+    /// Evaluates the shear modulus and the precomputed stiffness matrices from E and nu.
+    void computeTangents();
+
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedStrain, double pressure, TimeStep *tStep);    
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedStrain, double pressure, TimeStep *tStep);
 
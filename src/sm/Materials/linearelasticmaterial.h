@@ -36,6 +36,8 @@
 #define linearelasticmaterial_h
 
 #include "../sm/Materials/structuralmaterial.h"
+#include "floatarrayf.h"
+#include "floatmatrixf.h"
 
 namespace oofem {
 /**
@@ -73,6 +75,17 @@ public:
     virtual void giveRealStressVector_Fiber(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     virtual void giveRealStressVector_AxisymMembrane1d(FloatArray &answer, GaussPoint *gp, const FloatArray &dStrain, TimeStep *tStep);
 
+    /**
+     * Fixed size variant of give3dMaterialStiffnessMatrix, used by the stress evaluation of the receiver.
+     * Default implementation converts the result of give3dMaterialStiffnessMatrix.
+     */
+    virtual FloatMatrixF< 6, 6 >give3dMaterialStiffnessMatrixF(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
+    /**
+     * Fixed size variant of givePlaneStressStiffMtrx, used by the stress evaluation of the receiver.
+     * Default implementation converts the result of givePlaneStressStiffMtrx.
+     */
+    virtual FloatMatrixF< 3, 3 >givePlaneStressStiffMtrxF(MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
+
     virtual void giveEshelbyStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedF, TimeStep *tStep);
     double giveEnergyDensity(GaussPoint *gp, TimeStep *tStep);
 
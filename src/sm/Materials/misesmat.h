@@ -38,6 +38,7 @@
 #include "../sm/Materials/structuralmaterial.h"
 #include "../sm/Materials/structuralms.h"
 #include "Materials/linearelasticmaterial.h"
+#include "materialstatestore.h"
 #include "dictionary.h"
 #include "floatarray.h"
 #include "floatmatrix.h"
@@ -105,6 +106,14 @@ public:
 
     void performPlasticityReturn(GaussPoint *gp, const FloatArray &totalStrain);
     void performPlasticityReturn_PlaneStress(GaussPoint *gp, const FloatArray &totalStrain);
+    /**
+     * Performs the radial return of the deviatoric trial stress if the yield condition is violated.
+     * @param stressDev Deviatoric trial stress, replaced by the returned one.
+     * @param plStrain Plastic strain, updated.
+     * @param kappa Cumulative plastic strain, updated.
+     * @param trialS Norm of the deviatoric trial stress.
+     */
+    void performRadialReturn(FloatArray &stressDev, FloatArray &plStrain, double &kappa, double trialS);
     double computeDamage(GaussPoint *gp, TimeStep *tStep);
     double computeDamageParam(double tempKappa);
     double computeDamageParamPrime(double tempKappa);
@@ -135,6 +144,8 @@ public:
     virtual void give1dStressStiffMtrx(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep); 
 
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
+    virtual void giveRealStressVector_3dBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
+    virtual bool hasStressBatchKernel() const { return typeid( * this ) == typeid( MisesMat ); }
     virtual void giveRealStressVector_PlaneStress(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     virtual void giveRealStressVector_1d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
 
@@ -153,12 +164,23 @@ protected:
 
 class MisesMatStatus : public StructuralMaterialStatus
 {
-protected:
-    /// Plastic strain (initial).
-    FloatArray plasticStrain;
+public:
+    /// Layout of the history record of the receiver.
+    enum MM_HistoryVariable {
+        /// Plastic strain components (at most 6).
+        MM_PlasticStrain,
+        /// Cumulative plastic strain.
+        MM_Kappa = MM_PlasticStrain + 6,
+        /// Damage.
+        MM_Damage,
+        MM_RecordSize
+    };
 
-    /// Plastic strain (final).
-    FloatArray tempPlasticStrain;
+protected:
+    /// History variables (converged and non-equilibrated), see MM_HistoryVariable.
+    InlineMaterialStateRecord< MM_RecordSize >history;
+    /// Number of plastic strain components in history, given by the material mode.
+    int plasticStrainSize;
 
     /// Deviatoric trial stress - needed for tangent stiffness.
     FloatArray trialStressD;
@@ -170,42 +192,34 @@ protected:
     FloatArray effStress;
     FloatArray tempEffStress;
 
-    /// Cumulative plastic strain (initial).
-    double kappa;
-
-    /// Cumulative plastic strain (final).
-    double tempKappa;
-
-    /************************/
-    double tempDamage, damage;
-    /******************************/
-
     double dGamma;
 
 
 public:
-    MisesMatStatus(int n, Domain * d, GaussPoint * g);
+    MisesMatStatus(int n, Domain * d, GaussPoint * g, std :: shared_ptr< MaterialStateStore >store = nullptr);
     virtual ~MisesMatStatus();
 
-    const FloatArray &givePlasticStrain() { return plasticStrain; }
+    void givePlasticStrain(FloatArray &answer) const { history.giveVector(answer, MM_PlasticStrain, plasticStrainSize); }
+    /// Returns i-th component of plastic strain, without copying the whole vector.
+    double givePlasticStrain(int i) const { return history.give(MM_PlasticStrain + i - 1); }
 
     const FloatArray &giveTrialStressDev() { return trialStressD; }
 
     /*******************************************/
     double giveTrialStressVol() { return trialStressV; }
     /*******************************************/
-    double giveDamage() { return damage; }
-    double giveTempDamage() { return tempDamage; }
+    double giveDamage() { return history.give(MM_Damage); }
+    double giveTempDamage() { return history.giveTemp(MM_Damage); }
 
-    double giveCumulativePlasticStrain() { return kappa; }
-    double giveTempCumulativePlasticStrain() { return tempKappa; }
+    double giveCumulativePlasticStrain() { return history.give(MM_Kappa); }
+    double giveTempCumulativePlasticStrain() { return history.giveTemp(MM_Kappa); }
 
 
     const FloatArray & giveTempEffectiveStress() { return tempEffStress; }
     const FloatArray & giveEffectiveStress() { return effStress; }
 
-    void letTempPlasticStrainBe(const FloatArray &values) { tempPlasticStrain = values; }
-    const FloatArray &getTempPlasticStrain() const { return tempPlasticStrain; }
+    void letTempPlasticStrainBe(const FloatArray &values);
+    void getTempPlasticStrain(FloatArray &answer) const { history.giveTempVector(answer, MM_PlasticStrain, plasticStrainSize); }
 
     void letTrialStressDevBe(const FloatArray &values) { trialStressD = values; }
 
@@ -219,13 +233,13 @@ public:
     void setDGamma(double dg) {dGamma = dg;}
     double giveDGamma() { return dGamma;}
     
-    void setTempCumulativePlasticStrain(double value) { tempKappa = value; }
+    void setTempCumulativePlasticStrain(double value) { history.setTemp(MM_Kappa, value); }
     /****************************************/
-    void setTempDamage(double value) { tempDamage = value; }
+    void setTempDamage(double value) { history.setTemp(MM_Damage, value); }
     /************************************************/
 
 
-    const FloatArray &givePlasDef() { return plasticStrain; }
+    void givePlasDef(FloatArray &answer) const { this->givePlasticStrain(answer); }
 
     virtual void printOutputAt(FILE *file, TimeStep *tStep);
 
@@ -44,6 +44,7 @@
 //@{
 #define _IFT_StructuralFE2Material_Name "structfe2material"
 #define _IFT_StructuralFE2Material_fileName "filename"
+#define _IFT_StructuralFE2Material_linearRVE "linearrve"
 //@}
 
 namespace oofem {
@@ -60,6 +61,8 @@ protected:
 
     FloatMatrix tangent;
     bool oldTangent;
+    /// True if the RVE has been solved for the current temp strain.
+    bool solved;
 
 public:
     StructuralFE2MaterialStatus(int n, Domain * d, GaussPoint * g,  const std :: string & inputfile);
@@ -71,6 +74,14 @@ public:
     void markOldTangent();
     void computeTangent(TimeStep *tStep);
 
+    /// Marks the RVE as solved for the current temp strain.
+    void markSolved() { this->solved = true; }
+    /**
+     * Checks if the RVE has already been solved for given strain in the current step,
+     * in which case the temp stress can be used directly.
+     */
+    bool isSolvedFor(const FloatArray &strain) const;
+
     /// Creates/Initiates the RVE problem.
     bool createRVE(int n, GaussPoint *gp, const std :: string &inputfile);
 
@@ -98,6 +109,13 @@ public:
  * - It must have a PrescribedGradient boundary condition.
  * - It must be the first boundary condition
  *
+ * The subscale problems of all integration points are solved in a batch before the internal forces are assembled
+ * (see solveSubscaleProblems), spread over the available OpenMP threads. Every integration point owns its RVE, so
+ * each solve is independent, and it starts from the converged state of the previous step. When compiled with PETSc,
+ * the RVEs are solved (and their tangents computed) one at a time, as PETSc is not thread safe.
+ * If the subscale problem is linear (linearrve flag), a single RVE is solved for unit strains once and the resulting
+ * tangent is shared by all integration points, which then need no RVE of their own.
+ *
  * @author Mikael Öhman 
  */
 class StructuralFE2Material : public StructuralMaterial
@@ -105,6 +123,10 @@ class StructuralFE2Material : public StructuralMaterial
 protected:
     std :: string inputfile;
     static int n;
+    /// Flag indicating that the subscale problem is linear, and that one tangent is shared by all integration points.
+    bool linearRVE;
+    /// The shared tangent for linear subscale problems.
+    FloatMatrix linearTangent;
 
 public:
     StructuralFE2Material(int n, Domain * d);
@@ -117,11 +139,18 @@ public:
     virtual bool isCharacteristicMtrxSymmetric(MatResponseMode rMode) { return true; }
 
     virtual MaterialStatus *CreateStatus(GaussPoint *gp) const;
+    virtual void solveSubscaleProblems(Domain *d, TimeStep *tStep);
     const void giveDeviatoricProjectionMatrix(FloatMatrix &answer);
     // stress computation methods
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     
     virtual void give3dMaterialStiffnessMatrix(FloatMatrix &answer, MatResponseMode mode, GaussPoint *gp, TimeStep *tStep);
+
+protected:
+    /// Computes the shared tangent of a linear subscale problem (if not already done).
+    void computeLinearTangent(GaussPoint *gp, TimeStep *tStep);
+    /// Solves the RVE of given status for given strain and gives the homogenized stress in Voigt form.
+    static void solveRVE(FloatArray &answer, StructuralFE2MaterialStatus *ms, const FloatArray &strain, TimeStep *tStep);
 };
 
 } // end namespace oofem
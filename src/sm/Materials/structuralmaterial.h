@@ -38,11 +38,13 @@
 #include "material.h"
 #include "floatarray.h"
 #include "floatmatrix.h"
+#include "floatmatrixf.h"
 #include "matconst.h"
 #include "matstatus.h"
 #include "stressstrainprincmode.h"
 #include "valuemodetype.h"
 #include <vector>
+#include <typeinfo>
 
 ///@name Input fields for StructuralMaterial
 //@{
@@ -180,6 +182,26 @@ public:
                                       const FloatArray &reducedStrain, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector for second Piola-Kirchoff stress
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
+    /**
+     * Computes the real stress vectors of a batch of integration points in 3d stress space.
+     * Strains and stresses are stored as structure of arrays, i.e. one row per integration point, so that
+     * each component is contiguous over the batch and can be processed by vector instructions.
+     * The temporary history variables of all points are updated as by giveRealStressVector_3d.
+     * Default implementation evaluates the points one by one by giveRealStressVector_3d,
+     * so do the overloaded ones unless the class has a batch kernel (see hasStressBatchKernel).
+     * Only the stresses are batched, the material stiffness (give3dMaterialStiffnessMatrix) is still evaluated point by point.
+     * @param answer Stresses, one row per integration point.
+     * @param gps Integration points, all of them using the receiver.
+     * @param strains Strains, one row per integration point.
+     * @param tStep Current time step (most models are able to respond only when tStep is current time step).
+     */
+    virtual void giveRealStressVector_3dBatch(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
+    /**
+     * Returns true if the receiver evaluates giveRealStressVector_3dBatch by a kernel equivalent to its giveRealStressVector_3d.
+     * Material classes opt in for themselves only, derived classes (which may change the constitutive model)
+     * have to opt in explicitly.
+     */
+    virtual bool hasStressBatchKernel() const { return false; }
     /// Default implementation relies on giveRealStressVector_3d
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     /// Iteratively calls giveRealStressVector_3d to find the stress controlled equal to zero·
@@ -322,6 +344,13 @@ public:
     
     static void applyElasticStiffness(FloatArray &stress, const FloatArray &strain, double EModulus, double nu);
     static void applyElasticCompliance(FloatArray &strain, const FloatArray &stress, double EModulus, double nu);
+    /**
+     * Applies the stiffness matrix to a batch of strains stored as structure of arrays.
+     * @param answer Stresses, one row per point.
+     * @param d Stiffness matrix.
+     * @param strains Strains, one row per point.
+     */
+    static void applyStiffnessBatch(FloatMatrix &answer, const FloatMatrixF< 6, 6 > &d, const FloatMatrix &strains);
 
     //@}
 
@@ -38,6 +38,7 @@
 #include "nonstationarytransportproblem.h"
 #include "sparselinsystemnm.h"
 #include "sparsemtrx.h"
+#include "timestepcontroller.h"
 
 ///@name Input fields for NLTransientTransportProblem
 //@{
@@ -53,6 +54,8 @@ namespace oofem {
  * in the problem description. The solution is stored in UnknownsField, which can obtain/ project solution from/to DOFs (nodes). If the problem
  * keeps the same equation numbers, solution is taken from UnknownsField without any projection, which is more efficient. See the matlibmanual
  * for solution strategy of balance equations and the solution algorithm.
+ * When adaptive time stepping is requested, the step length follows the number of iterations and an estimate
+ * of the temporal error; steps which do not converge or exceed the error tolerance are cut and solved again.
  *
  * @todo Documentation errors (there is no "UnknownsField" used here).
  */
@@ -66,6 +69,12 @@ protected:
     nlttp_ModeType NR_Mode;
     int MANRMSteps;
     int currentIterations;
+    /// Adaptive time step controller; inactive unless adaptive stepping is requested.
+    TimeStepController stepController;
+    /// Solution rate of the last accepted step, used as an explicit predictor for the temporal error estimate.
+    FloatArray lastSolutionRate;
+    /// Relative temporal error estimate of the last accepted step.
+    double timeError;
 
 public:
     /// Constructor.
@@ -88,12 +97,20 @@ public:
     virtual void updateDofUnknownsDictionary(DofManager *dman, TimeStep *tStep);
 
     virtual int giveCurrentNumberOfIterations() {return currentIterations;}
+    virtual contextIOResultType saveContext(DataStream *stream, ContextMode mode, void *obj = NULL);
+    virtual contextIOResultType restoreContext(DataStream *stream, ContextMode mode, void *obj = NULL);
+    virtual bool isTimeSteppingFinished(TimeStep *tStep);
 
 protected:
     virtual void updateInternalState(TimeStep *tStep);
     virtual void applyIC(TimeStep *tStep);
     void createPreviousSolutionInDofUnknownsDictionary(TimeStep *tStep);
     void assembleAlgorithmicPartOfRhs(FloatArray &rhs, const UnknownNumberingScheme &s, TimeStep *tStep);
+    /**
+     * Shortens the current step to the given length, rolls back the temporary state of integration points
+     * and makes the step ready to be solved again.
+     */
+    void retryStep(TimeStep *tStep, double stepLength);
 };
 } // end namespace oofem
 #endif // nltransienttransportproblem_h
@@ -0,0 +1,407 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+#
+#  oofem_benchmark.py        www.oofem.org
+#
+# Description
+#
+#     Generates input files with structured meshes of selectable size,
+#     runs them with oofem and records the wall time, the time spent in
+#     individual phases of the analysis (taken from the performance report,
+#     see "perfreport" analysis parameter), the peak resident set size and the
+#     throughput (number of equations times number of solution steps per second).
+#     The results are compared against a stored baseline; a case is reported
+#     as a regression if its wall time (or time of any phase) exceeds the
+#     baseline by more than the given tolerance.
+#     Cases with suffix "_pointwise" repeat the preceding case with stresses
+#     evaluated point by point (see "stressbatch" analysis parameter); the
+#     speedup of the internal force assembly due to batched evaluation is
+#     reported for them.
+#
+# Usage
+#
+#     oofem_benchmark.py -o path/to/oofem [-s small|medium|large] [-n N]
+#                        [-c case1,case2,...] [-w workdir] [-b baseline.json]
+#                        [-u] [-t tolerance] [-l]
+#
+#     -o  oofem executable
+#     -s  problem size (number of elements along the edge is taken from the size table)
+#     -n  number of elements along the edge (overrides -s)
+#     -c  comma separated list of cases to run (default all, see -l)
+#     -w  working directory for generated inputs and outputs
+#     -b  baseline file; if it does not exist, it is created from the current run
+#     -u  overwrite baseline with the results of the current run
+#     -t  relative tolerance for regression check (default 0.25)
+#     -l  list available cases
+#
+#     Returns nonzero exit code if any case fails or a regression is detected.
+#
+from __future__ import print_function
+
+import getopt
+import json
+import os
+import subprocess
+import sys
+import time
+
+# number of elements along the edge of the block for individual sizes,
+# 2d meshes use n^(3/2) elements along the edge to get similar number of elements
+sizes = {
+    'small': 6,
+    'medium': 12,
+    'large': 24,
+}
+
+# times (in seconds) below this limit are not checked against baseline
+noiseFloor = 0.05
+
+
+class Mesh:
+    """Structured mesh of a block [0,n]^dim with unit spacing, nodes are created on demand."""
+
+    def __init__(self, dim, n):
+        self.dim = dim
+        self.n = n
+        self.nodes = {}
+        self.coords = []
+        self.elements = []
+
+    def node(self, *c):
+        # c are coordinates in half-units (to support midside nodes)
+        key = tuple(c)
+        num = self.nodes.get(key)
+        if num is None:
+            self.coords.append([0.5 * x for x in c])
+            num = len(self.coords)
+            self.nodes[key] = num
+        return num
+
+    def nodesOnFace(self, axis, value):
+        # value in element units
+        return sorted(num for key, num in self.nodes.items() if key[axis] == 2 * value)
+
+
+# local coordinates of linear and quadratic hexahedron nodes (see FEI3dHexaLin, FEI3dHexaQuad)
+hexaCorners = [(-1, -1, 1), (-1, 1, 1), (1, 1, 1), (1, -1, 1), (-1, -1, -1), (-1, 1, -1), (1, 1, -1), (1, -1, -1)]
+hexaEdges = [(1, 2), (2, 3), (3, 4), (4, 1), (5, 6), (6, 7), (7, 8), (8, 5), (1, 5), (2, 6), (3, 7), (4, 8)]
+# Kuhn subdivision of the unit cube into 6 tetrahedra (along the diagonal 000-111)
+cubeTets = [((0, 0, 0), (1, 0, 0), (1, 1, 0), (1, 1, 1)), ((0, 0, 0), (1, 0, 0), (1, 0, 1), (1, 1, 1)),
+            ((0, 0, 0), (0, 1, 0), (1, 1, 0), (1, 1, 1)), ((0, 0, 0), (0, 1, 0), (0, 1, 1), (1, 1, 1)),
+            ((0, 0, 0), (0, 0, 1), (1, 0, 1), (1, 1, 1)), ((0, 0, 0), (0, 0, 1), (0, 1, 1), (1, 1, 1))]
+
+
+def hexaMesh(n, quadratic=False):
+    mesh = Mesh(3, n)
+    for i in range(n):
+        for j in range(n):
+            for k in range(n):
+                corners = [(2 * i + 1 + u, 2 * j + 1 + v, 2 * k + 1 + w) for (u, v, w) in hexaCorners]
+                enodes = [mesh.node(*c) for c in corners]
+                if quadratic:
+                    for (a, b) in hexaEdges:
+                        ca, cb = corners[a - 1], corners[b - 1]
+                        enodes.append(mesh.node(*[(x + y) // 2 for x, y in zip(ca, cb)]))
+                mesh.elements.append(enodes)
+    return mesh
+
+
+def tetMesh(n):
+    mesh = Mesh(3, n)
+    for i in range(n):
+        for j in range(n):
+            for k in range(n):
+                for tet in cubeTets:
+                    p = [(2 * (i + a), 2 * (j + b), 2 * (k + c)) for (a, b, c) in tet]
+                    # positive orientation as expected by FEI3dTetLin
+                    d1 = [p[1][x] - p[0][x] for x in range(3)]
+                    d2 = [p[2][x] - p[0][x] for x in range(3)]
+                    d3 = [p[3][x] - p[0][x] for x in range(3)]
+                    vol = d1[0] * (d2[1] * d3[2] - d2[2] * d3[1]) - d1[1] * (d2[0] * d3[2] - d2[2] * d3[0]) + d1[2] * (d2[0] * d3[1] - d2[1] * d3[0])
+                    if vol < 0:
+                        p[1], p[2] = p[2], p[1]
+                    mesh.elements.append([mesh.node(*c) for c in p])
+    return mesh
+
+
+def quadMesh(n):
+    mesh = Mesh(2, n)
+    for i in range(n):
+        for j in range(n):
+            corners = [(2 * i, 2 * j), (2 * i + 2, 2 * j), (2 * i + 2, 2 * j + 2), (2 * i, 2 * j + 2)]
+            mesh.elements.append([mesh.node(*c) for c in corners])
+    return mesh
+
+
+def writeInput(fileName, outName, title, analysis, domain, mesh, elemType, records, nbc, nltf, sets, elemExtra=''):
+    # records: cross section, material, boundary conditions and time functions (one per line)
+    # sets: list of node lists (set 1 always contains all elements)
+    with open(fileName, 'w') as f:
+        f.write('%s\n%s\n%s\n' % (outName, title, analysis))
+        f.write('domain %s\n' % domain)
+        f.write('OutputManager\n')
+        f.write('ndofman %d nelem %d ncrosssect 1 nmat 1 nbc %d nic 0 nltf %d nset %d\n' %
+                (len(mesh.coords), len(mesh.elements), nbc, nltf, len(sets) + 1))
+        for num, c in enumerate(mesh.coords):
+            c = c + [0.0] * (3 - len(c))
+            f.write('node %d coords 3 %g %g %g\n' % (num + 1, c[0], c[1], c[2]))
+        for num, enodes in enumerate(mesh.elements):
+            f.write('%s %d nodes %d %s%s\n' % (elemType, num + 1, len(enodes), ' '.join(str(x) for x in enodes), elemExtra))
+        for r in records:
+            f.write(r + '\n')
+        f.write('Set 1 elementranges {(1 %d)}\n' % len(mesh.elements))
+        for num, s in enumerate(sets):
+            f.write('Set %d nodes %d %s\n' % (num + 2, len(s), ' '.join(str(x) for x in s)))
+
+
+def structuralBlock(mesh, ndofs):
+    # clamped at x = 0, prescribed displacement in x direction at x = n
+    fixed = mesh.nodesOnFace(0, 0)
+    loaded = mesh.nodesOnFace(0, mesh.n)
+    dofs = ' '.join(str(x + 1) for x in range(ndofs))
+    zeros = ' '.join('0.0' for x in range(ndofs))
+    bcs = ['BoundaryCondition 1 loadTimeFunction 1 dofs %d %s values %d %s set 2' % (ndofs, dofs, ndofs, zeros),
+           'BoundaryCondition 2 loadTimeFunction %(ltf)d dofs 1 1 values 1 %(disp)g set 3']
+    neq = ndofs * len(mesh.coords) - ndofs * len(fixed) - len(loaded)
+    return bcs, [fixed, loaded], neq
+
+
+def linearStatic(name, size, elemType, meshType):
+    if meshType == 'quad':
+        mesh = quadMesh(int(round(size ** 1.5)))
+        domain, ndofs, cs = '2dPlaneStress', 2, 'SimpleCS 1 thick 1.0 material 1 set 1'
+    else:
+        mesh = {'hexa': hexaMesh(size), 'hexa2': hexaMesh(max(1, size // 2), True), 'tet': tetMesh(size)}[meshType]
+        domain, ndofs, cs = '3d', 3, 'SimpleCS 1 material 1 set 1'
+    bcs, sets, neq = structuralBlock(mesh, ndofs)
+    records = [cs, 'IsoLE 1 d 1.0 E 30000.0 n 0.2 tAlpha 0.0'] + [b % {'ltf': 1, 'disp': 0.01} for b in bcs] + ['ConstantFunction 1 f(t) 1.0']
+    writeInput(name + '.in', name + '.out', 'Benchmark: linear elastic block of %s elements' % elemType,
+               'LinearStatic nsteps 1 perfreport 1 nmodules 0', domain, mesh, elemType, records, 2, 1, sets)
+    return neq, 1
+
+
+def nonlinearStatic(name, size, batch=1):
+    nsteps = 10
+    mesh = hexaMesh(size)
+    bcs, sets, neq = structuralBlock(mesh, 3)
+    # displacement at the last step corresponds to the average strain 2.5e-4 (about 2.5 times the damage threshold)
+    records = ['SimpleCS 1 material 1 set 1',
+               'idm1 1 d 1.0 E 30000.0 n 0.2 e0 1.e-4 ef 1.e-3 equivstraintype 0 talpha 0.0 damlaw 0'] + \
+              [b % {'ltf': 2, 'disp': 2.5e-4 * mesh.n / nsteps} for b in bcs] + \
+              ['ConstantFunction 1 f(t) 1.0', 'PiecewiseLinFunction 2 t 2 0.0 %d.0 f(t) 2 0.0 %d.0' % (nsteps, nsteps)]
+    writeInput(name + '.in', name + '.out', 'Benchmark: block of LSpace elements with isotropic damage, displacement control',
+               'NonLinearStatic nsteps %d rtolv 1.e-4 maxiter 100 controlmode 1 stiffmode 1 stressbatch %d perfreport 1 nmodules 0' % (nsteps, batch),
+               '3d', mesh, 'LSpace', records, 2, 2, sets)
+    return neq, nsteps
+
+
+def podOnline(name, size):
+    # the offline (slave) problem is the nonlinear static benchmark, the master problem uses the same mesh
+    # and evaluates the snapshots with hyper-reduced operators precompiled over the reduced integration domain
+    neq, nsteps = nonlinearStatic(name + '_slave', size)
+    with open(name + '_slave.in') as f:
+        lines = f.read().split('\n')
+    lines[0] = name + '.out'
+    lines[1] = 'Benchmark: reduced order model (POD, hyper-reduction) of damaged block of LSpace elements'
+    lines[2] = 'pod nsteps %d rtolv 1.e-4 maxiter 100 controlmode 1 stiffmode 1 smtype 1 perfreport 1 nmodules 0 ' \
+               'slaveprob 1 "%s_slave.in" hr 1 ridextension 1 precompiledonline 1' % (nsteps, name)
+    with open(name + '.in', 'w') as f:
+        f.write('\n'.join(lines))
+    return neq, nsteps
+
+
+def transport(name, size):
+    nsteps = 10
+    mesh = hexaMesh(size)
+    cold = mesh.nodesOnFace(0, 0)
+    hot = mesh.nodesOnFace(0, mesh.n)
+    records = ['SimpleTransportCS 1 mat 1 set 1', 'IsoHeat 1 d 2400.0 k 1.0 c 1000.0',
+               'BoundaryCondition 1 loadTimeFunction 1 dofs 1 10 values 1 0.0 set 2',
+               'BoundaryCondition 2 loadTimeFunction 1 dofs 1 10 values 1 15.0 set 3',
+               'ConstantFunction 1 f(t) 1.0']
+    writeInput(name + '.in', name + '.out', 'Benchmark: transient heat conduction in a block of Brick1_ht elements',
+               'NonStationaryProblem nsteps %d deltat 3600.0 alpha 0.5 perfreport 1 nmodules 0' % nsteps,
+               'HeatTransfer', mesh, 'brick1ht', records, 2, 1, [cold, hot])
+    return len(mesh.coords) - len(cold) - len(hot), nsteps
+
+
+def explicitDynamics(name, size, batch=1):
+    nsteps = 50
+    mesh = hexaMesh(size)
+    fixed = mesh.nodesOnFace(0, 0)
+    loaded = mesh.nodesOnFace(0, mesh.n)
+    # unit wave speed and element size, time step well below the stability limit
+    records = ['SimpleCS 1 material 1 set 1', 'IsoLE 1 d 1.0 E 1.0 n 0.2 tAlpha 0.0',
+               'BoundaryCondition 1 loadTimeFunction 1 dofs 3 1 2 3 values 3 0.0 0.0 0.0 set 2',
+               'NodalLoad 2 loadTimeFunction 1 dofs 3 1 2 3 components 3 0.001 0.0 0.0 set 3',
+               'ConstantFunction 1 f(t) 1.0']
+    writeInput(name + '.in', name + '.out', 'Benchmark: explicit dynamics of a block of LSpace elements',
+               'NlDEIDynamic nsteps %d dumpcoef 0.0 deltat 0.1 stressbatch %d perfreport 1 nmodules 0' % (nsteps, batch),
+               '3d', mesh, 'LSpace', records, 2, 1, [fixed, loaded])
+    return 3 * (len(mesh.coords) - len(fixed)), nsteps
+
+
+# case name -> generator(name, size) returning (number of equations, number of steps)
+cases = [
+    ('linearstatic_lspace', lambda name, size: linearStatic(name, size, 'LSpace', 'hexa')),
+    ('linearstatic_qspace', lambda name, size: linearStatic(name, size, 'QSpace', 'hexa2')),
+    ('linearstatic_ltrspace', lambda name, size: linearStatic(name, size, 'LTRSpace', 'tet')),
+    ('linearstatic_planestress2d', lambda name, size: linearStatic(name, size, 'PlaneStress2d', 'quad')),
+    ('nonlinearstatic_damage_lspace', nonlinearStatic),
+    ('nonlinearstatic_damage_lspace_pointwise', lambda name, size: nonlinearStatic(name, size, 0)),
+    ('pod_online_damage_lspace', podOnline),
+    ('nonstationary_brick1ht', transport),
+    ('nldeidynamic_lspace', explicitDynamics),
+    ('nldeidynamic_lspace_pointwise', lambda name, size: explicitDynamics(name, size, 0)),
+]
+
+
+def runOofem(oofem, inputFile):
+    # returns (exit code, wall time, peak rss in kB or None)
+    with open(inputFile[:-3] + '.log', 'w') as log:
+        start = time.time()
+        proc = subprocess.Popen([oofem, '-f', inputFile], stdout=log, stderr=subprocess.STDOUT)
+        rss = None
+        if hasattr(os, 'wait4'):
+            pid, status, usage = os.wait4(proc.pid, 0)
+            proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+            rss = usage.ru_maxrss
+            if sys.platform == 'darwin':
+                rss //= 1024  # reported in bytes
+        else:
+            proc.wait()
+        return proc.returncode, time.time() - start, rss
+
+
+def readPhases(perfFile):
+    try:
+        with open(perfFile) as f:
+            report = json.load(f)
+    except (IOError, ValueError):
+        return {}, {}
+    phases = dict((s['section'], s['time']) for s in report['total']['sections'])
+    return phases, report['total']['counters']
+
+
+def phaseTime(phases, section):
+    # total time of given section, summed over all places of the hierarchy it appears at
+    return sum(t for path, t in phases.items() if path.split('/')[-1] == section)
+
+
+def compare(name, result, base, tolerance):
+    # returns list of messages describing regressions
+    messages = []
+    checks = [('wall', result['wall'], base.get('wall'))]
+    for phase, t in sorted(result['phases'].items()):
+        checks.append((phase, t, base.get('phases', {}).get(phase)))
+    for what, t, tb in checks:
+        if tb is not None and t > noiseFloor and t > tb * (1. + tolerance):
+            messages.append('%s: %s %.3fs exceeds baseline %.3fs by %.0f%%' % (name, what, t, tb, 100. * (t / tb - 1.)))
+    return messages
+
+
+def usage():
+    print(__doc__ if __doc__ else '')
+    print('Usage: oofem_benchmark.py -o oofem [-s size] [-n N] [-c cases] [-w workdir] [-b baseline] [-u] [-t tolerance] [-l]')
+
+
+def main():
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], 'o:s:n:c:w:b:ut:lh')
+    except getopt.GetoptError as err:
+        print(str(err))
+        usage()
+        return 2
+
+    oofem, size, n, selected, workdir, baselineFile, update, tolerance = None, 'small', None, None, '.', None, False, 0.25
+    for o, a in opts:
+        if o == '-o':
+            oofem = os.path.abspath(a)
+        elif o == '-s':
+            size = a
+        elif o == '-n':
+            n = int(a)
+        elif o == '-c':
+            selected = a.split(',')
+        elif o == '-w':
+            workdir = a
+        elif o == '-b':
+            baselineFile = os.path.abspath(a)
+        elif o == '-u':
+            update = True
+        elif o == '-t':
+            tolerance = float(a)
+        elif o == '-l':
+            for name, gen in cases:
+                print(name)
+            return 0
+        else:
+            usage()
+            return 0
+
+    if oofem is None:
+        usage()
+        return 2
+    if n is None:
+        if size not in sizes:
+            print('Unknown size "%s", use one of %s' % (size, ', '.join(sorted(sizes))))
+            return 2
+        n = sizes[size]
+    sizeKey = 'n%d' % n
+
+    if not os.path.isdir(workdir):
+        os.makedirs(workdir)
+    os.chdir(workdir)
+
+    baseline = {}
+    if baselineFile and os.path.exists(baselineFile):
+        with open(baselineFile) as f:
+            baseline = json.load(f)
+
+    results = {}
+    failed = []
+    regressions = []
+    print('%-32s %10s %8s %10s %12s' % ('case', 'equations', 'wall[s]', 'rss[MB]', 'dofs/s'))
+    for name, gen in cases:
+        if selected and name not in selected:
+            continue
+        caseName = '%s_%s' % (name, sizeKey)
+        neq, nsteps = gen(caseName, n)
+        code, wall, rss = runOofem(oofem, caseName + '.in')
+        if code != 0:
+            failed.append(name)
+            print('%-32s failed (exit code %d), see %s.log' % (name, code, caseName))
+            continue
+        phases, counters = readPhases(caseName + '.out.perf.json')
+        solve = phases.get('solution step', wall)
+        result = {'equations': neq, 'steps': nsteps, 'wall': wall, 'rss': rss,
+                  'dofspersec': neq * nsteps / solve if solve > 0 else 0.,
+                  'phases': phases, 'counters': counters}
+        results[name] = result
+        print('%-32s %10d %8.3f %10s %12.4g' % (name, neq, wall, '%.1f' % (rss / 1024.) if rss else '-', result['dofspersec']))
+        for phase, t in sorted(phases.items()):
+            print('    %-40s %10.4f' % (phase, t))
+        if name.endswith('_pointwise') and name[:-10] in results:
+            batched = phaseTime(results[name[:-10]]['phases'], 'vector assembly')
+            pointwise = phaseTime(phases, 'vector assembly')
+            if batched > 0:
+                print('    %-40s %10.2f' % ('speedup of batched vector assembly', pointwise / batched))
+        base = baseline.get(sizeKey, {}).get(name)
+        if base and not update:
+            regressions += compare(name, result, base, tolerance)
+
+    if baselineFile and results and (update or sizeKey not in baseline):
+        baseline.setdefault(sizeKey, {}).update(results)
+        with open(baselineFile, 'w') as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print('Baseline written to %s' % baselineFile)
+
+    for msg in regressions:
+        print('Regression: ' + msg)
+    if failed:
+        print('Failed cases: ' + ', '.join(failed))
+    return 1 if failed or regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,32 @@
+# Checks the JSON performance report of a test case against the "#%PERF%" lines of its input file.
+# Each line gives a text, which has to be found in the report, for example
+#   #%PERF% {"section": "solution step/linear solve", "calls": 1,
+#   #%PERF% "factorizations": 1, "linear solves": 1,
+# The report name is given by the output file name on the first line of the input file.
+#
+# Usage: cmake -DINPUT=case.in -P checkperfreport.cmake
+if (NOT INPUT)
+    message (FATAL_ERROR "Input file is not given")
+endif ()
+
+file (STRINGS "${INPUT}" output LIMIT_COUNT 1)
+string (STRIP "${output}" output)
+set (report "${output}.perf.json")
+if (NOT EXISTS "${report}")
+    message (FATAL_ERROR "Performance report ${report} not found")
+endif ()
+file (READ "${report}" contents)
+
+file (STRINGS "${INPUT}" checks REGEX "^#%PERF% ")
+if (NOT checks)
+    message (FATAL_ERROR "No #%PERF% lines found in ${INPUT}")
+endif ()
+foreach (check ${checks})
+    string (REGEX REPLACE "^#%PERF% " "" text "${check}")
+    string (FIND "${contents}" "${text}" position)
+    if (position EQUAL -1)
+        message (SEND_ERROR "${report} does not contain: ${text}")
+    else ()
+        message (STATUS "Found: ${text}")
+    endif ()
+endforeach ()
@@ -0,0 +1,16 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.4
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2014 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sat Oct 17 22:15:52 2026
+
+tests on creep at variable temperature and relative humidity
+Domain type: hema1, default ndofs per node is 2
+
+
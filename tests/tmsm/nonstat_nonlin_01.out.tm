@@ -0,0 +1,106 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.4
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2014 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sat Oct 17 22:19:50 2026
+
+Quadrilateral element subjected to heat flux (Newton b.c)
+Domain type: heattransfer, default ndofs per node is 1
+
+
+
+==============================================================
+Output for time 0.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  1.00000000e+01
+Node           2 (       2):
+  dof 10   d  1.00000000e+01
+Node           3 (       3):
+  dof 10   d  1.00000000e+01
+Node           4 (       4):
+  dof 10   d  1.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 1.0000e+01   flow -0.0000e+00 4.2633e-14
+  GP  1.2  :  state 1.0000e+01   flow -0.0000e+00 4.2633e-14
+  GP  1.3  :  state 1.0000e+01   flow -0.0000e+00 4.2633e-14
+  GP  1.4  :  state 1.0000e+01   flow -0.0000e+00 4.2633e-14
+
+
+
+==============================================================
+Output for time 3.60000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.00000000e+01
+Node           2 (       2):
+  dof 10   d  2.00000000e+01
+Node           3 (       3):
+  dof 10   d  2.00000000e+01
+Node           4 (       4):
+  dof 10   d  2.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.0000e+01   flow -1.7053e-13 1.2790e-13
+  GP  1.2  :  state 2.0000e+01   flow -0.0000e+00 1.2790e-13
+  GP  1.3  :  state 2.0000e+01   flow -1.7053e-13 8.5265e-14
+  GP  1.4  :  state 2.0000e+01   flow -0.0000e+00 8.5265e-14
+
+
+
+==============================================================
+Output for time 7.20000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.00000000e+01
+Node           2 (       2):
+  dof 10   d  3.00000000e+01
+Node           3 (       3):
+  dof 10   d  3.00000000e+01
+Node           4 (       4):
+  dof 10   d  3.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.0000e+01   flow -0.0000e+00 2.1316e-13
+  GP  1.2  :  state 3.0000e+01   flow -0.0000e+00 2.1316e-13
+  GP  1.3  :  state 3.0000e+01   flow -0.0000e+00 2.1316e-13
+  GP  1.4  :  state 3.0000e+01   flow -0.0000e+00 2.1316e-13
+
+
@@ -0,0 +1,181 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.4
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2014 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sat Oct 17 22:15:52 2026
+
+Quadrilateral elements subjected to heat flux (Newton b.c)
+Domain type: heattransfer, default ndofs per node is 1
+
+
+
+==============================================================
+Output for time 3.60000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  9.98146959e-01
+Node           5 (       5):
+  dof 10   d  9.98146959e-01
+Node           6 (       6):
+  dof 10   d  9.98146959e-01
+Node           7 (       7):
+  dof 10   d  7.29756332e+01
+Node           8 (       8):
+  dof 10   d  7.29756332e+01
+Node           9 (       9):
+  dof 10   d  7.29756332e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.1093e-01   flow 4.6629e-15 -1.4972e+00
+  GP  1.2  :  state 7.8721e-01   flow 1.9984e-14 -1.4972e+00
+  GP  1.3  :  state 2.1093e-01   flow 4.6629e-15 -1.4972e+00
+  GP  1.4  :  state 7.8721e-01   flow 1.9984e-14 -1.4972e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.1093e-01   flow -1.3989e-14 -1.4972e+00
+  GP  1.2  :  state 7.8721e-01   flow -5.1958e-14 -1.4972e+00
+  GP  1.3  :  state 2.1093e-01   flow -1.3989e-14 -1.4972e+00
+  GP  1.4  :  state 7.8721e-01   flow -5.1958e-14 -1.4972e+00
+element 3 (       3) :
+  GP  1.1  :  state 1.6209e+01   flow -0.0000e+00 -1.0797e+02
+  GP  1.2  :  state 5.7765e+01   flow -0.0000e+00 -1.0797e+02
+  GP  1.3  :  state 1.6209e+01   flow -0.0000e+00 -1.0797e+02
+  GP  1.4  :  state 5.7765e+01   flow -0.0000e+00 -1.0797e+02
+element 4 (       4) :
+  GP  1.1  :  state 1.6209e+01   flow 4.2633e-14 -1.0797e+02
+  GP  1.2  :  state 5.7765e+01   flow 3.4106e-13 -1.0797e+02
+  GP  1.3  :  state 1.6209e+01   flow 4.2633e-14 -1.0797e+02
+  GP  1.4  :  state 5.7765e+01   flow 3.4106e-13 -1.0797e+02
+
+
+
+==============================================================
+Output for time 7.20000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  3.88482167e+00
+Node           5 (       5):
+  dof 10   d  3.88482167e+00
+Node           6 (       6):
+  dof 10   d  3.88482167e+00
+Node           7 (       7):
+  dof 10   d  1.42064950e+02
+Node           8 (       8):
+  dof 10   d  1.42064950e+02
+Node           9 (       9):
+  dof 10   d  1.42064950e+02
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 8.2096e-01   flow -7.9936e-15 -5.8272e+00
+  GP  1.2  :  state 3.0639e+00   flow -3.1974e-14 -5.8272e+00
+  GP  1.3  :  state 8.2096e-01   flow -7.9936e-15 -5.8272e+00
+  GP  1.4  :  state 3.0639e+00   flow -3.1974e-14 -5.8272e+00
+element 2 (       2) :
+  GP  1.1  :  state 8.2096e-01   flow -2.3981e-14 -5.8272e+00
+  GP  1.2  :  state 3.0639e+00   flow -8.5265e-14 -5.8272e+00
+  GP  1.3  :  state 8.2096e-01   flow -2.3981e-14 -5.8272e+00
+  GP  1.4  :  state 3.0639e+00   flow -8.5265e-14 -5.8272e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.3086e+01   flow 8.5265e-14 -2.0727e+02
+  GP  1.2  :  state 1.1286e+02   flow 3.4106e-13 -2.0727e+02
+  GP  1.3  :  state 3.3086e+01   flow 8.5265e-14 -2.0727e+02
+  GP  1.4  :  state 1.1286e+02   flow 3.4106e-13 -2.0727e+02
+element 4 (       4) :
+  GP  1.1  :  state 3.3086e+01   flow -0.0000e+00 -2.0727e+02
+  GP  1.2  :  state 1.1286e+02   flow 3.4106e-13 -2.0727e+02
+  GP  1.3  :  state 3.3086e+01   flow -0.0000e+00 -2.0727e+02
+  GP  1.4  :  state 1.1286e+02   flow 3.4106e-13 -2.0727e+02
+
+
+
+==============================================================
+Output for time 1.08000000e+05 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  8.45463247e+00
+Node           5 (       5):
+  dof 10   d  8.45463247e+00
+Node           6 (       6):
+  dof 10   d  8.45463247e+00
+Node           7 (       7):
+  dof 10   d  2.07578282e+02
+Node           8 (       8):
+  dof 10   d  2.07578282e+02
+Node           9 (       9):
+  dof 10   d  2.07578282e+02
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 1.7867e+00   flow -1.5987e-14 -1.2682e+01
+  GP  1.2  :  state 6.6680e+00   flow -6.3949e-14 -1.2682e+01
+  GP  1.3  :  state 1.7867e+00   flow -1.5987e-14 -1.2682e+01
+  GP  1.4  :  state 6.6680e+00   flow -6.3949e-14 -1.2682e+01
+element 2 (       2) :
+  GP  1.1  :  state 1.7867e+00   flow -2.6645e-14 -1.2682e+01
+  GP  1.2  :  state 6.6680e+00   flow -1.0658e-13 -1.2682e+01
+  GP  1.3  :  state 1.7867e+00   flow -2.6645e-14 -1.2682e+01
+  GP  1.4  :  state 6.6680e+00   flow -1.0658e-13 -1.2682e+01
+element 3 (       3) :
+  GP  1.1  :  state 5.0534e+01   flow 8.5265e-14 -2.9869e+02
+  GP  1.2  :  state 1.6550e+02   flow 6.8212e-13 -2.9869e+02
+  GP  1.3  :  state 5.0534e+01   flow 8.5265e-14 -2.9869e+02
+  GP  1.4  :  state 1.6550e+02   flow 6.8212e-13 -2.9869e+02
+element 4 (       4) :
+  GP  1.1  :  state 5.0534e+01   flow -0.0000e+00 -2.9869e+02
+  GP  1.2  :  state 1.6550e+02   flow 3.4106e-13 -2.9869e+02
+  GP  1.3  :  state 5.0534e+01   flow -0.0000e+00 -2.9869e+02
+  GP  1.4  :  state 1.6550e+02   flow 3.4106e-13 -2.9869e+02
+
+